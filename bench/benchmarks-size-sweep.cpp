@@ -0,0 +1,545 @@
+#include <benchmark/benchmark.h>
+
+#include <Lz/Lz.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Every adaptor is measured over [MinSize, MaxSize] input elements, next to a hand-written loop that computes the same
+// result. The reporter at the bottom of this file pairs `<Name>Lz` with `<Name>Loop` and prints the overhead ratio per size.
+constexpr static std::int64_t MinSize = 32;
+constexpr static std::int64_t MaxSize = 10000000;
+constexpr static std::int64_t SizeMultiplier = 8;
+
+namespace {
+std::vector<int> makeSequence(const std::int64_t size) {
+    std::vector<int> sequence(static_cast<std::size_t>(size));
+    std::iota(sequence.begin(), sequence.end(), 0);
+    return sequence;
+}
+
+std::string makeSentence(const std::int64_t size) {
+    std::string sentence(static_cast<std::size_t>(size), 'a');
+    for (std::size_t i = 7; i < sentence.size(); i += 8) {
+        sentence[i] = ' ';
+    }
+    return sentence;
+}
+
+// Comma separated fields of 1 to 16 characters, like the rows of a CSV file
+std::string makeFields(const std::int64_t size) {
+    std::string fields(static_cast<std::size_t>(size), 'a');
+    for (std::size_t i = 0, length = 1; i + length < fields.size(); i += length + 1, length = length % 16 + 1) {
+        fields[i + length] = ',';
+    }
+    return fields;
+}
+
+void setItemsProcessed(benchmark::State& state) {
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+} // namespace
+
+static void FilterLz(benchmark::State& state) {
+    const std::vector<int> input = makeSequence(state.range(0));
+    auto filter = lz::filter(input, [](const int i) noexcept { return i % 3 == 0; });
+
+    for (auto _ : state) {
+        std::int64_t sum = 0;
+        for (const int i : filter) {
+            sum += i;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    setItemsProcessed(state);
+}
+
+static void FilterLoop(benchmark::State& state) {
+    const std::vector<int> input = makeSequence(state.range(0));
+
+    for (auto _ : state) {
+        std::int64_t sum = 0;
+        for (const int i : input) {
+            if (i % 3 == 0) {
+                sum += i;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    setItemsProcessed(state);
+}
+
+static void MapLz(benchmark::State& state) {
+    const std::vector<int> input = makeSequence(state.range(0));
+    auto map = lz::map(input, [](const int i) noexcept { return i * 3 + 1; });
+
+    for (auto _ : state) {
+        std::int64_t sum = 0;
+        for (const int i : map) {
+            sum += i;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    setItemsProcessed(state);
+}
+
+static void MapLoop(benchmark::State& state) {
+    const std::vector<int> input = makeSequence(state.range(0));
+
+    for (auto _ : state) {
+        std::int64_t sum = 0;
+        for (const int i : input) {
+            sum += i * 3 + 1;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    setItemsProcessed(state);
+}
+
+static void ZipLz(benchmark::State& state) {
+    const std::vector<int> a = makeSequence(state.range(0));
+    const std::vector<int> b = makeSequence(state.range(0));
+    auto zipper = lz::zip(a, b);
+
+    for (auto _ : state) {
+        std::int64_t sum = 0;
+        for (const auto tup : zipper) {
+            sum += std::get<0>(tup) + std::get<1>(tup);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    setItemsProcessed(state);
+}
+
+static void ZipLoop(benchmark::State& state) {
+    const std::vector<int> a = makeSequence(state.range(0));
+    const std::vector<int> b = makeSequence(state.range(0));
+
+    for (auto _ : state) {
+        std::int64_t sum = 0;
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            sum += a[i] + b[i];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    setItemsProcessed(state);
+}
+
+static void FlattenLz(benchmark::State& state) {
+    constexpr std::int64_t rowSize = 16;
+    const std::vector<std::vector<int>> input(static_cast<std::size_t>(state.range(0) / rowSize), makeSequence(rowSize));
+    auto flatten = lz::flatten(input);
+
+    for (auto _ : state) {
+        std::int64_t sum = 0;
+        for (const int i : flatten) {
+            sum += i;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    setItemsProcessed(state);
+}
+
+static void FlattenLoop(benchmark::State& state) {
+    constexpr std::int64_t rowSize = 16;
+    const std::vector<std::vector<int>> input(static_cast<std::size_t>(state.range(0) / rowSize), makeSequence(rowSize));
+
+    for (auto _ : state) {
+        std::int64_t sum = 0;
+        for (const std::vector<int>& row : input) {
+            for (const int i : row) {
+                sum += i;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    setItemsProcessed(state);
+}
+
+static void ConcatenateLz(benchmark::State& state) {
+    const std::vector<int> a = makeSequence(state.range(0) / 2);
+    const std::vector<int> b = makeSequence(state.range(0) - state.range(0) / 2);
+    auto concatenate = lz::concat(a, b);
+
+    for (auto _ : state) {
+        std::int64_t sum = 0;
+        for (const int i : concatenate) {
+            sum += i;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    setItemsProcessed(state);
+}
+
+static void ConcatenateLoop(benchmark::State& state) {
+    const std::vector<int> a = makeSequence(state.range(0) / 2);
+    const std::vector<int> b = makeSequence(state.range(0) - state.range(0) / 2);
+
+    for (auto _ : state) {
+        std::int64_t sum = 0;
+        for (const int i : a) {
+            sum += i;
+        }
+        for (const int i : b) {
+            sum += i;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    setItemsProcessed(state);
+}
+
+static void ChunksLz(benchmark::State& state) {
+    const std::vector<int> input = makeSequence(state.range(0));
+    auto chunks = lz::chunks(input, 16);
+
+    for (auto _ : state) {
+        std::int64_t sum = 0;
+        for (auto&& chunk : chunks) {
+            for (const int i : chunk) {
+                sum += i;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    setItemsProcessed(state);
+}
+
+static void ChunksLoop(benchmark::State& state) {
+    const std::vector<int> input = makeSequence(state.range(0));
+
+    for (auto _ : state) {
+        std::int64_t sum = 0;
+        for (std::size_t first = 0; first < input.size(); first += 16) {
+            const std::size_t last = std::min(first + 16, input.size());
+            for (std::size_t i = first; i < last; ++i) {
+                sum += input[i];
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    setItemsProcessed(state);
+}
+
+static void JoinWhereLz(benchmark::State& state) {
+    const std::vector<int> a = makeSequence(state.range(0));
+    std::vector<int> b = lz::range(0, static_cast<int>(state.range(0)), 2).toVector();
+    auto joiner = lz::joinWhere(
+        a, b, [](const int i) noexcept { return i; }, [](const int i) noexcept { return i; },
+        [](const int x, const int y) noexcept { return x + y; });
+
+    for (auto _ : state) {
+        std::int64_t sum = 0;
+        for (const int i : joiner) {
+            sum += i;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    setItemsProcessed(state);
+}
+
+static void JoinWhereLoop(benchmark::State& state) {
+    const std::vector<int> a = makeSequence(state.range(0));
+    std::vector<int> b = lz::range(0, static_cast<int>(state.range(0)), 2).toVector();
+
+    for (auto _ : state) {
+        std::int64_t sum = 0;
+        for (const int x : a) {
+            for (auto it = std::lower_bound(b.begin(), b.end(), x); it != b.end() && *it == x; ++it) {
+                sum += x + *it;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    setItemsProcessed(state);
+}
+
+static void StringSplitterLz(benchmark::State& state) {
+    const std::string input = makeSentence(state.range(0));
+    auto splitter = lz::split(input, ' ');
+
+    for (auto _ : state) {
+        std::size_t length = 0;
+        for (const std::string_view substring : splitter) {
+            length += substring.size();
+        }
+        benchmark::DoNotOptimize(length);
+    }
+    setItemsProcessed(state);
+}
+
+static void StringSplitterLoop(benchmark::State& state) {
+    const std::string input = makeSentence(state.range(0));
+
+    for (auto _ : state) {
+        std::size_t length = 0;
+        const std::string_view view = input;
+        std::size_t first = 0;
+        while (first < view.size()) {
+            const std::size_t last = std::min(view.find(' ', first), view.size());
+            length += view.substr(first, last - first).size();
+            first = last + 1;
+        }
+        benchmark::DoNotOptimize(length);
+    }
+    setItemsProcessed(state);
+}
+
+// Measures the block scanner of `lz::split` for short fields, where a `find` per field is dominated by its call overhead
+static void SplitFieldsLz(benchmark::State& state) {
+    const std::string input = makeFields(state.range(0));
+    auto splitter = lz::split(input, ',');
+
+    for (auto _ : state) {
+        std::size_t length = 0;
+        for (const std::string_view field : splitter) {
+            length += field.size();
+        }
+        benchmark::DoNotOptimize(length);
+    }
+    setItemsProcessed(state);
+}
+
+static void SplitFieldsLoop(benchmark::State& state) {
+    const std::string input = makeFields(state.range(0));
+
+    for (auto _ : state) {
+        std::size_t length = 0;
+        const std::string_view view = input;
+        std::size_t first = 0;
+        while (first < view.size()) {
+            const std::size_t last = std::min(view.find(',', first), view.size());
+            length += last - first;
+            first = last + 1;
+        }
+        benchmark::DoNotOptimize(length);
+    }
+    setItemsProcessed(state);
+}
+
+static void EnumerateLz(benchmark::State& state) {
+    const std::vector<int> input = makeSequence(state.range(0));
+    auto enumeration = lz::enumerate(input);
+
+    for (auto _ : state) {
+        std::int64_t sum = 0;
+        for (const auto pair : enumeration) {
+            sum += pair.first + pair.second;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    setItemsProcessed(state);
+}
+
+static void EnumerateLoop(benchmark::State& state) {
+    const std::vector<int> input = makeSequence(state.range(0));
+
+    for (auto _ : state) {
+        std::int64_t sum = 0;
+        int index = 0;
+        for (const int i : input) {
+            sum += index++ + i;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    setItemsProcessed(state);
+}
+
+static void TakeEveryLz(benchmark::State& state) {
+    const std::vector<int> input = makeSequence(state.range(0));
+    auto takeEvery = lz::takeEvery(input, 2);
+
+    for (auto _ : state) {
+        std::int64_t sum = 0;
+        for (const int i : takeEvery) {
+            sum += i;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    setItemsProcessed(state);
+}
+
+static void TakeEveryLoop(benchmark::State& state) {
+    const std::vector<int> input = makeSequence(state.range(0));
+
+    for (auto _ : state) {
+        std::int64_t sum = 0;
+        for (std::size_t i = 0; i < input.size(); i += 2) {
+            sum += input[i];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    setItemsProcessed(state);
+}
+
+static void ExcludeLz(benchmark::State& state) {
+    const std::vector<int> input = makeSequence(state.range(0));
+    const std::ptrdiff_t quarter = static_cast<std::ptrdiff_t>(state.range(0) / 4);
+    auto exclude = lz::exclude(input, quarter, quarter * 2);
+
+    for (auto _ : state) {
+        std::int64_t sum = 0;
+        for (const int i : exclude) {
+            sum += i;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    setItemsProcessed(state);
+}
+
+static void ExcludeLoop(benchmark::State& state) {
+    const std::vector<int> input = makeSequence(state.range(0));
+    const std::size_t quarter = static_cast<std::size_t>(state.range(0) / 4);
+
+    for (auto _ : state) {
+        std::int64_t sum = 0;
+        for (std::size_t i = 0; i < input.size(); ++i) {
+            if (i < quarter || i >= quarter * 2) {
+                sum += input[i];
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    setItemsProcessed(state);
+}
+
+static void ExceptLz(benchmark::State& state) {
+    const std::vector<int> input = makeSequence(state.range(0));
+    const std::vector<int> toExcept = lz::range(0, static_cast<int>(state.range(0)), 4).toVector();
+    auto except = lz::except(input, toExcept);
+
+    for (auto _ : state) {
+        std::int64_t sum = 0;
+        for (const int i : except) {
+            sum += i;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    setItemsProcessed(state);
+}
+
+static void ExceptLoop(benchmark::State& state) {
+    const std::vector<int> input = makeSequence(state.range(0));
+    const std::vector<int> toExcept = lz::range(0, static_cast<int>(state.range(0)), 4).toVector();
+
+    for (auto _ : state) {
+        std::int64_t sum = 0;
+        for (const int i : input) {
+            if (!std::binary_search(toExcept.begin(), toExcept.end(), i)) {
+                sum += i;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    setItemsProcessed(state);
+}
+
+static void ToVectorLz(benchmark::State& state) {
+    const std::vector<int> input = makeSequence(state.range(0));
+    auto map = lz::map(input, [](const int i) noexcept { return i * 3 + 1; });
+
+    for (auto _ : state) {
+        std::vector<int> result = map.toVector();
+        benchmark::DoNotOptimize(result.data());
+    }
+    setItemsProcessed(state);
+}
+
+static void ToVectorLoop(benchmark::State& state) {
+    const std::vector<int> input = makeSequence(state.range(0));
+
+    for (auto _ : state) {
+        std::vector<int> result;
+        result.reserve(input.size());
+        for (const int i : input) {
+            result.push_back(i * 3 + 1);
+        }
+        benchmark::DoNotOptimize(result.data());
+    }
+    setItemsProcessed(state);
+}
+
+#define LZ_SIZE_SWEEP(NAME)                                                                                                      \
+    BENCHMARK(NAME##Lz)->RangeMultiplier(SizeMultiplier)->Range(MinSize, MaxSize);                                               \
+    BENCHMARK(NAME##Loop)->RangeMultiplier(SizeMultiplier)->Range(MinSize, MaxSize)
+
+LZ_SIZE_SWEEP(Chunks);
+LZ_SIZE_SWEEP(Concatenate);
+LZ_SIZE_SWEEP(Enumerate);
+LZ_SIZE_SWEEP(Except);
+LZ_SIZE_SWEEP(Exclude);
+LZ_SIZE_SWEEP(Filter);
+LZ_SIZE_SWEEP(Flatten);
+LZ_SIZE_SWEEP(JoinWhere);
+LZ_SIZE_SWEEP(Map);
+LZ_SIZE_SWEEP(SplitFields);
+LZ_SIZE_SWEEP(StringSplitter);
+LZ_SIZE_SWEEP(TakeEvery);
+LZ_SIZE_SWEEP(ToVector);
+LZ_SIZE_SWEEP(Zip);
+
+namespace {
+// Prints the regular console output, and afterwards a table with the `Lz` time divided by the `Loop` time for every adaptor and
+// input size.
+class OverheadReporter final : public benchmark::ConsoleReporter {
+    // (adaptor name, input size) -> (lz time, loop time)
+    std::map<std::pair<std::string, std::int64_t>, std::pair<double, double>> _times;
+
+    static bool removeSuffix(std::string& name, const std::string& suffix) {
+        if (name.size() < suffix.size() || name.compare(name.size() - suffix.size(), suffix.size(), suffix) != 0) {
+            return false;
+        }
+        name.erase(name.size() - suffix.size());
+        return true;
+    }
+
+public:
+    void ReportRuns(const std::vector<Run>& reports) override {
+        benchmark::ConsoleReporter::ReportRuns(reports);
+
+        for (const Run& run : reports) {
+            if (run.error_occurred || run.run_type != Run::RT_Iteration) {
+                continue;
+            }
+            std::string name = run.run_name.function_name;
+            if (removeSuffix(name, "Loop")) {
+                _times[{ name, std::stoll(run.run_name.args) }].second = run.GetAdjustedCPUTime();
+            }
+            else if (removeSuffix(name, "Lz")) {
+                _times[{ name, std::stoll(run.run_name.args) }].first = run.GetAdjustedCPUTime();
+            }
+        }
+    }
+
+    void Finalize() override {
+        benchmark::ConsoleReporter::Finalize();
+
+        std::FILE* out = stdout;
+        std::fprintf(out, "\n%-16s %10s %16s %16s %10s\n", "Adaptor", "Size", "lz (cpu)", "loop (cpu)", "lz/loop");
+        for (const auto& entry : _times) {
+            const double lzTime = entry.second.first;
+            const double loopTime = entry.second.second;
+            if (lzTime == 0 || loopTime == 0) {
+                continue;
+            }
+            std::fprintf(out, "%-16s %10lld %16.1f %16.1f %10.2f\n", entry.first.first.c_str(),
+                         static_cast<long long>(entry.first.second), lzTime, loopTime, lzTime / loopTime);
+        }
+    }
+};
+} // namespace
+
+int main(int argc, char** argv) {
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    OverheadReporter reporter;
+    benchmark::RunSpecifiedBenchmarks(&reporter);
+    return 0;
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#ifndef LZ_CSV_HPP
+#define LZ_CSV_HPP
+
+#include "detail/BasicIteratorView.hpp"
+#include "detail/CsvIterator.hpp"
+
+namespace lz {
+template<class SubString>
+class CsvRecords final : public internal::BasicIteratorView<internal::CsvRecordIterator<SubString>> {
+public:
+    using iterator = internal::CsvRecordIterator<SubString>;
+    using const_iterator = iterator;
+    using value_type = SubString;
+
+    CsvRecords(const char* data, const std::size_t size) :
+        internal::BasicIteratorView<iterator>(iterator(0, data, size), iterator(size, data, size)) {
+    }
+
+    CsvRecords() = default;
+};
+
+template<class SubString>
+class CsvFields final : public internal::BasicIteratorView<internal::CsvFieldIterator<SubString>> {
+public:
+    using iterator = internal::CsvFieldIterator<SubString>;
+    using const_iterator = iterator;
+    using value_type = std::string;
+
+    CsvFields(const char* data, const std::size_t size, const char delimiter) :
+        internal::BasicIteratorView<iterator>(iterator(data, size, delimiter, false), iterator(data, size, delimiter, true)) {
+    }
+
+    CsvFields() = default;
+};
+
+// Start of group
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+#if defined(LZ_HAS_STRING_VIEW)
+template<class SubString = std::string_view, class Buffer>
+#elif defined(LZ_STANDALONE)
+template<class SubString = std::string, class Buffer>
+#else
+template<class SubString = fmt::string_view, class Buffer>
+#endif
+/**
+ * @brief Splits a CSV buffer into records (RFC 4180), without copying them. Records are separated by line feeds that are not
+ * between quotes, which are found by classifying the buffer 64 characters at a time (see `lz::csvFields`). The line feed and a
+ * carriage return before it are not part of the records, and the last record does not need to end with a line feed.
+ * @details The quotes and escaped quotes of the records are kept, use `lz::csvFields` to split a record into fields.
+ * @tparam SubString The string type of the records. If C++17, this will default to `std::string_view`. If `LZ_STANDALONE` is not
+ * defined and C++17 is not defined, this will default to `std::string`. Otherwise it will default to `fmt::string_view`.
+ * @param buffer The characters to split, anything with `data()` and `size()`, for e.g. a `std::string` or an `lz::MappedFile`.
+ * @return A CsvRecords object that can be converted to an arbitrary container or can be iterated over using
+ * `for (auto... lz::csvRecords(...))`.
+ */
+LZ_NODISCARD CsvRecords<SubString> csvRecords(const Buffer& buffer) {
+    return { buffer.data(), buffer.size() };
+}
+
+#if defined(LZ_HAS_STRING_VIEW)
+template<class SubString = std::string_view, class Buffer>
+#elif defined(LZ_STANDALONE)
+template<class SubString = std::string, class Buffer>
+#else
+template<class SubString = fmt::string_view, class Buffer>
+#endif
+internal::EnableIf<!std::is_lvalue_reference<Buffer>::value && !internal::IsCharView<internal::Decay<Buffer>>::value,
+                   CsvRecords<SubString>>
+csvRecords(Buffer&& buffer) = delete;
+
+#if defined(LZ_HAS_STRING_VIEW)
+template<class SubString = std::string_view, class Record>
+#else
+template<class SubString = std::string, class Record>
+#endif
+/**
+ * @brief Splits a CSV record into fields (RFC 4180). Fields are separated by delimiters that are not between quotes. Like
+ * simdcsv, the record is classified 64 characters at a time: the prefix xor of the quote bitmap marks the quoted characters,
+ * which are then removed from the delimiter bitmap.
+ * @details The surrounding quotes of quoted fields are removed. Fields without escaped quotes (`""`) point into the record, the
+ * others are unescaped into a buffer in the iterator, and are only valid until the iterator is incremented. The `value_type` of
+ * the view is therefore always `std::string`, so collecting the fields (e.g. using `toVector()`) copies them. Unlike
+ * `lz::split`, a delimiter at the end of a record is followed by an empty field.
+ * @tparam SubString The string type of the fields while iterating. If C++17, this will default to `std::string_view`, otherwise
+ * it will default to `std::string`.
+ * @param record The record to split, anything with `data()` and `size()`, for e.g. a record of `lz::csvRecords`.
+ * @param delimiter The delimiter between the fields, `','` by default.
+ * @return A CsvFields object that can be converted to an arbitrary container or can be iterated over using
+ * `for (auto... lz::csvFields(...))`.
+ */
+LZ_NODISCARD CsvFields<SubString> csvFields(const Record& record, const char delimiter = ',') {
+    return { record.data(), record.size(), delimiter };
+}
+
+#if defined(LZ_HAS_STRING_VIEW)
+template<class SubString = std::string_view, class Record>
+#else
+template<class SubString = std::string, class Record>
+#endif
+internal::EnableIf<!std::is_lvalue_reference<Record>::value && !internal::IsCharView<internal::Decay<Record>>::value,
+                   CsvFields<SubString>>
+csvFields(Record&& record, char delimiter = ',') = delete;
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_CSV_HPP
@@ -24,16 +24,44 @@ public:
     using const_iterator = iterator;
     using value_type = typename iterator::value_type;
 
+private:
+    using HashSet = typename iterator::HashSet;
+
+    static std::shared_ptr<const HashSet>
+    makeHashSet(const IteratorToExcept& toExceptBegin, const IteratorToExcept& toExceptEnd, std::true_type /* useHashSet */) {
+        return std::make_shared<const HashSet>(toExceptBegin, toExceptEnd);
+    }
+
+    static std::shared_ptr<const HashSet>
+    makeHashSet(const IteratorToExcept&, const IteratorToExcept&, std::false_type /* useHashSet */) noexcept {
+        return nullptr;
+    }
+
 #ifdef LZ_HAS_EXECUTION
-    LZ_CONSTEXPR_CXX_20 Except(Iterator begin, Iterator end, IteratorToExcept toExceptBegin, IteratorToExcept toExceptEnd,
-                               Comparer comparer, Execution execPolicy) :
-        internal::BasicIteratorView<iterator>(iterator(std::move(begin), end, toExceptBegin, toExceptEnd, comparer, execPolicy),
-                                              iterator(end, end, toExceptBegin, toExceptEnd, comparer, execPolicy)) {
+    Except(Iterator begin, Iterator end, IteratorToExcept toExceptBegin, IteratorToExcept toExceptEnd,
+           std::shared_ptr<const HashSet> set, Comparer comparer, Execution execPolicy) :
+        internal::BasicIteratorView<iterator>(
+            iterator(std::move(begin), end, toExceptBegin, toExceptEnd, set, comparer, execPolicy),
+            iterator(end, end, toExceptBegin, toExceptEnd, set, comparer, execPolicy)) {
+    }
+
+public:
+    Except(Iterator begin, Iterator end, IteratorToExcept toExceptBegin, IteratorToExcept toExceptEnd, Comparer comparer,
+           Execution execPolicy) :
+        Except(std::move(begin), std::move(end), toExceptBegin, toExceptEnd,
+               makeHashSet(toExceptBegin, toExceptEnd, typename iterator::UseHashSet()), std::move(comparer), execPolicy) {
     }
 #else  // ^^^ has execution vvv ! has execution
+    Except(Iterator begin, Iterator end, IteratorToExcept toExceptBegin, IteratorToExcept toExceptEnd,
+           std::shared_ptr<const HashSet> set, Comparer comparer) :
+        internal::BasicIteratorView<iterator>(iterator(std::move(begin), end, std::move(toExceptBegin), toExceptEnd, set, comparer),
+                                              iterator(end, end, toExceptEnd, toExceptEnd, set, comparer)) {
+    }
+
+public:
     Except(Iterator begin, Iterator end, IteratorToExcept toExceptBegin, IteratorToExcept toExceptEnd, Comparer comparer) :
-        internal::BasicIteratorView<iterator>(iterator(std::move(begin), end, std::move(toExceptBegin), toExceptEnd, comparer),
-                                              iterator(end, end, toExceptEnd, toExceptEnd, comparer)) {
+        Except(std::move(begin), std::move(end), toExceptBegin, toExceptEnd,
+               makeHashSet(toExceptBegin, toExceptEnd, typename iterator::UseHashSet()), std::move(comparer)) {
     }
 #endif // LZ_HAS_EXECUTION
 
@@ -50,6 +78,10 @@ public:
  * @brief Skips elements in [begin, end) that is contained by [toExceptBegin, toExceptEnd). [toExceptBegin, toExceptEnd) must be
  * sorted manually before creating this view.
  * @attention [toExceptBegin, toExceptEnd) must be sorted  manually before creating this view.
+ * @details If `comparer` is `std::less` and the value type can be hashed using `std::hash`, [toExceptBegin, toExceptEnd) is put
+ * into a hash set once per view, and every element is looked up in O(1). Otherwise, a cursor is moved forward through
+ * [toExceptBegin, toExceptEnd), which takes O(n + m) in total if [begin, end) is sorted as well. With a parallel policy, every
+ * element is looked up in the hash set or binary searched.
  * @param execPolicy The std::execution::* policy.
  * @param begin The beginning of the sequence to skip elements in.
  * @param end The ending of the sequence to skip elements in.
@@ -71,6 +103,10 @@ exceptRange(Iterator begin, Iterator end, IteratorToExcept toExceptBegin, Iterat
 /**
  * @brief Skips elements iterable that is contained by toExcept. ToExcept must be sorted manually before creating this view.
  * @attention ToExcept must be sorted manually before creating this view.
+ * @details If `comparer` is `std::less` and the value type can be hashed using `std::hash`, `toExcept` is put into a hash set once
+ * per view, and every element is looked up in O(1). Otherwise, a cursor is moved forward through `toExcept`, which takes
+ * O(n + m) in total if `iterable` is sorted as well. With a parallel policy, every element is looked up in the hash set or
+ * binary searched.
  * @param execPolicy The std::execution::* policy.
  * @param iterable Sequence to iterate over.
  * @param toExcept Sequence that contains items that must be skipped in `iterable`.
@@ -92,6 +128,9 @@ LZ_NODISCARD LZ_CONSTEXPR_CXX_20
  * @brief Skips elements in [begin, end) that is contained by [toExceptBegin, toExceptEnd). [toExceptBegin, toExceptEnd) must be
  * sorted manually before creating this view.
  * @attention [toExceptBegin, toExceptEnd) must be sorted  manually before creating this view.
+ * @details If `comparer` is `std::less` and the value type can be hashed using `std::hash`, [toExceptBegin, toExceptEnd) is put
+ * into a hash set once per view, and every element is looked up in O(1). Otherwise, a cursor is moved forward through
+ * [toExceptBegin, toExceptEnd), which takes O(n + m) in total if [begin, end) is sorted as well.
  * @param begin The beginning of the sequence to skip elements in.
  * @param end The ending of the sequence to skip elements in.
  * @param toExceptBegin The beginning of the sequence that may not be contained in [begin, end).
@@ -112,6 +151,9 @@ exceptRange(Iterator begin, Iterator end, IteratorToExcept toExceptBegin, Iterat
 /**
  * @brief Skips elements iterable that is contained by toExcept. ToExcept must be sorted manually before creating this view.
  * @attention ToExcept must be sorted manually before creating this view.
+ * @details If `comparer` is `std::less` and the value type can be hashed using `std::hash`, `toExcept` is put into a hash set once
+ * per view, and every element is looked up in O(1). Otherwise, a cursor is moved forward through `toExcept`, which takes
+ * O(n + m) in total if `iterable` is sorted as well.
  * @param iterable Sequence to iterate over.
  * @param toExcept Sequence that contains items that must be skipped in `iterable`.
  * @param comparer Comparer for binary search (operator < is default) in IterableToExcept
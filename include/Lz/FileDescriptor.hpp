@@ -0,0 +1,107 @@
+#pragma once
+
+#ifndef LZ_FILE_DESCRIPTOR_HPP
+#define LZ_FILE_DESCRIPTOR_HPP
+
+#include "InputStream.hpp"
+#include "detail/OutputSink.hpp"
+
+#include <cerrno>
+#include <system_error>
+
+#if defined(_WIN32)
+#    include <io.h>
+#else
+#    include <unistd.h>
+#endif // _WIN32
+
+// Reading from and writing to file descriptors is not part of Lz/Lz.hpp, so that the headers of the operating system are only
+// included by the code that uses them
+namespace lz {
+namespace internal {
+class FdSource {
+    int _fd{ -1 };
+
+public:
+    explicit FdSource(const int fd) noexcept : _fd(fd) {
+    }
+
+    // Reads up to `count` characters into `data`. Returns 0 only at the end of the file
+    std::size_t read(char* data, const std::size_t count) {
+        while (true) {
+#if defined(_WIN32)
+            const int result = ::_read(_fd, data, static_cast<unsigned>(count > 0x7FFFFFFF ? 0x7FFFFFFF : count));
+#else
+            const auto result = ::read(_fd, data, count);
+#endif // _WIN32
+            if (result >= 0) {
+                return static_cast<std::size_t>(result);
+            }
+            if (errno != EINTR) {
+                throw std::system_error(errno, std::generic_category(), "lz::fromFd");
+            }
+        }
+    }
+};
+
+class FdSink {
+    int _fd{ -1 };
+
+public:
+    explicit FdSink(const int fd) noexcept : _fd(fd) {
+    }
+
+    // Writes all `count` characters, a write may be interrupted or write only a part of them
+    void write(const char* data, std::size_t count) {
+        while (count != 0) {
+#if defined(_WIN32)
+            const int result = ::_write(_fd, data, static_cast<unsigned>(count > 0x7FFFFFFF ? 0x7FFFFFFF : count));
+#else
+            const auto result = ::write(_fd, data, count);
+#endif // _WIN32
+            if (result >= 0) {
+                data += result;
+                count -= static_cast<std::size_t>(result);
+            }
+            else if (errno != EINTR) {
+                throw std::system_error(errno, std::generic_category(), "lz::writeTo");
+            }
+        }
+    }
+};
+
+// Lets `writeTo` write to file descriptors, e.g. `lz::range(4).writeTo(1, ", ")`
+template<>
+struct SinkFor<int> {
+    using type = FdSink;
+};
+} // namespace internal
+
+// Start of group
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * @brief Returns an input iterator view over the characters of file descriptor `fd`, for e.g. a pipe or `0` for stdin. The file
+ * is read in blocks of `bufferSize` characters into a buffer that is reused, so that the whole file never has to be in memory at
+ * once. Use `.lines()` to iterate over its lines instead.
+ * @details Nothing is read until the first character is requested. The descriptor is not closed by the view.
+ * @param fd The file descriptor to read.
+ * @param bufferSize The amount of characters to read at once.
+ * @return An input iterator view over the characters of `fd`, which can be converted to an arbitrary container or can be
+ * iterated over using `for (auto... lz::fromFd(...))`.
+ * @throws std::system_error When iterating, if reading from `fd` fails.
+ */
+LZ_NODISCARD inline InputStream<internal::FdSource> fromFd(const int fd, const std::size_t bufferSize = 65536) {
+    return { internal::FdSource(fd), bufferSize };
+}
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_FILE_DESCRIPTOR_HPP
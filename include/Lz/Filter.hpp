@@ -51,7 +51,9 @@ public:
  * @param begin The beginning of the range.
  * @param end The ending of the range.
  * @param predicate A function that must return a bool, and needs a value type of the container as parameter.
- * @param execution The execution policy. Must be one of `std::execution`'s tags. Performs the find using this execution.
+ * @param execution The execution policy. Must be one of `std::execution`'s tags or a `lz::ThreadPoolExecutor`. Performs the find
+ * using this execution. If `[begin, end)` is random access, converting the filter to a container or using `copyTo` evaluates
+ * the predicate in parallel blocks and writes the matches directly to their place in the output.
  * @return A filter object from [begin, end) that can be converted to an arbitrary container or can be iterated
  * over.
  */
@@ -515,7 +515,7 @@ mean(Iterator begin, Iterator end, BinaryOp binaryOp = {}, Execution execution =
         sum = std::reduce(begin, end, ValueType{ 0 }, std::move(binaryOp));
     }
     else {
-        sum = std::reduce(execution, begin, end, ValueType{ 0 }, std::move(binaryOp));
+        sum = internal::reduce(execution, begin, end, ValueType{ 0 }, std::move(binaryOp));
     }
     return static_cast<double>(sum) / dist;
 }
@@ -706,7 +706,7 @@ median(Iterator begin, Iterator end, Comparer comparer = {}, Execution execution
         std::nth_element(begin, midIter, end, comparer);
     }
     else {
-        std::nth_element(execution, begin, midIter, end, comparer);
+        internal::nthElement(execution, begin, midIter, end, comparer);
     }
     if (internal::isEven(len)) {
         if constexpr (isSequenced) {
@@ -714,7 +714,7 @@ median(Iterator begin, Iterator end, Comparer comparer = {}, Execution execution
             return (static_cast<double>(*leftHalf) + *midIter) / 2.;
         }
         else {
-            const Iterator leftHalf = std::max_element(execution, begin, midIter, comparer);
+            const Iterator leftHalf = internal::maxElement(execution, begin, midIter, comparer);
             return (static_cast<double>(*leftHalf) + *midIter) / 2.;
         }
     }
@@ -754,7 +754,7 @@ findFirstOrDefault(Iterator begin, Iterator end, const T& toFind, const U& defau
         return static_cast<ValueType>(std::find(std::move(begin), end, toFind) == end ? defaultValue : toFind);
     }
     else {
-        return static_cast<ValueType>(std::find(execution, std::move(begin), end, toFind) == end ? defaultValue : toFind);
+        return static_cast<ValueType>(internal::find(execution, std::move(begin), end, toFind) == end ? defaultValue : toFind);
     }
 }
 
@@ -794,7 +794,7 @@ findFirstOrDefaultIf(Iterator begin, Iterator end, UnaryPredicate predicate, con
         return static_cast<ValueType>(pos == end ? defaultValue : *pos);
     }
     else {
-        const Iterator pos = std::find_if(execution, std::move(begin), end, std::move(predicate));
+        const Iterator pos = internal::findIf(execution, std::move(begin), end, std::move(predicate));
         return static_cast<ValueType>(pos == end ? defaultValue : *pos);
     }
 }
@@ -900,7 +900,7 @@ indexOf(Iterator begin, Iterator end, const T& val, Execution execution = std::e
         return pos == end ? npos : static_cast<std::size_t>(internal::getIterLength(begin, pos));
     }
     else {
-        const Iterator pos = std::find(execution, begin, end, val);
+        const Iterator pos = internal::find(execution, begin, end, val);
         return pos == end ? npos : static_cast<std::size_t>(internal::getIterLength(begin, pos));
     }
 }
@@ -936,7 +936,7 @@ indexOfIf(Iterator begin, Iterator end, UnaryFunc predicate, Execution execution
         return pos == end ? npos : static_cast<std::size_t>(internal::getIterLength(begin, pos));
     }
     else {
-        const Iterator pos = std::find_if(execution, begin, end, std::move(predicate));
+        const Iterator pos = internal::findIf(execution, begin, end, std::move(predicate));
         return pos == end ? npos : static_cast<std::size_t>(internal::getIterLength(begin, pos));
     }
 }
@@ -1015,7 +1015,7 @@ bool startsWith(IteratorA beginA, IteratorA endA, IteratorB beginB, IteratorB en
     else {
         static_assert(internal::IsForwardOrStrongerV<IteratorB>,
                       "The iterator type must be forward iterator or stronger. Prefer using std::execution::seq");
-        return std::search(execution, std::move(beginA), std::move(endA), std::move(beginB), std::move(endB),
+        return internal::search(execution, std::move(beginA), std::move(endA), std::move(beginB), std::move(endB),
                            std::move(compare)) != endA;
     }
 }
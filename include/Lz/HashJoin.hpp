@@ -0,0 +1,163 @@
+#pragma once
+
+#ifndef LZ_HASH_JOIN_HPP
+#define LZ_HASH_JOIN_HPP
+
+#include "detail/BasicIteratorView.hpp"
+#include "detail/HashJoinIterator.hpp"
+
+namespace lz {
+template<class IterA, class IterB, class SelectorA, class SelectorB, class ResultSelector, bool LeftOuter>
+class HashJoin final : public internal::BasicIteratorView<
+                           internal::HashJoinIterator<IterA, IterB, SelectorA, SelectorB, ResultSelector, LeftOuter>> {
+public:
+    using iterator = internal::HashJoinIterator<IterA, IterB, SelectorA, SelectorB, ResultSelector, LeftOuter>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+private:
+    using TableAPtr = typename iterator::TableAPtr;
+    using TableBPtr = typename iterator::TableBPtr;
+
+    // The table is built over A only if A is known to be the smaller sequence. A left outer join always probes A
+    static bool buildOverA(const IterA& iterA, const IterA& endA, const IterB& iterB, const IterB& endB) {
+        if (LeftOuter) {
+            return false;
+        }
+        const internal::SizeHint hintA = internal::getSizeHint(iterA, endA);
+        return hintA.hasUpper() && hintA.upper < internal::getSizeHint(iterB, endB).lower;
+    }
+
+    HashJoin(IterA iterA, IterA endA, IterB iterB, IterB endB, SelectorA a, SelectorB b, ResultSelector resultSelector,
+             TableAPtr tableA, TableBPtr tableB) :
+        internal::BasicIteratorView<iterator>(
+            iterator(std::move(iterA), endA, std::move(iterB), endB, tableA, tableB, a, b, resultSelector),
+            iterator(endA, endA, endB, endB, tableA, tableB, a, b, resultSelector)) {
+    }
+
+    HashJoin(IterA iterA, IterA endA, IterB iterB, IterB endB, SelectorA a, SelectorB b, ResultSelector resultSelector,
+             const bool overA) :
+        HashJoin(iterA, endA, iterB, endB, a, b, std::move(resultSelector),
+                 overA ? std::make_shared<const typename TableAPtr::element_type>(iterA, endA, a) : nullptr,
+                 overA ? nullptr : std::make_shared<const typename TableBPtr::element_type>(iterB, endB, b)) {
+    }
+
+public:
+    HashJoin(IterA iterA, IterA endA, IterB iterB, IterB endB, SelectorA a, SelectorB b, ResultSelector resultSelector) :
+        HashJoin(iterA, endA, iterB, endB, std::move(a), std::move(b), std::move(resultSelector),
+                 buildOverA(iterA, endA, iterB, endB)) {
+    }
+
+    HashJoin() = default;
+};
+
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * Performs an SQL-like inner join using a hash table. The keys returned by `a` and `b` are compared using `operator==` and
+ * hashed using `std::hash`. The table is built once, over sequence A if it is known to be smaller than B, and over B otherwise.
+ * The other sequence is probed lazily. Every pair of matching elements is returned, so duplicate keys on both sides are all
+ * joined with each other. Neither sequence needs to be sorted.
+ * @attention The order of the results follows the probed sequence. If the table is built over A, the results are in the order
+ * of B, otherwise in the order of A.
+ * @param iterA The beginning of the sequence A to join.
+ * @param endA The ending of the sequence A to join.
+ * @param iterB The beginning of the sequence B to join.
+ * @param endB The ending of the sequence B to join.
+ * @param a A function that returns a hashable key of an element of A.
+ * @param b A function that returns a hashable key of an element of B.
+ * @param resultSelector A function with parameters `fn(decltype(*iterA), decltype(*iterB))`, which is called for every
+ * match. It may return anything, for e.g. `std::make_tuple(valueTypeA, valueTypeB)`.
+ * @return A hash join iterator view object, which can be used to iterate over.
+ */
+template<class IterA, class IterB, class SelectorA, class SelectorB, class ResultSelector>
+LZ_NODISCARD HashJoin<IterA, IterB, SelectorA, SelectorB, ResultSelector, false>
+hashJoin(IterA iterA, IterA endA, IterB iterB, IterB endB, SelectorA a, SelectorB b, ResultSelector resultSelector) {
+    // clang-format off
+    return {
+        std::move(iterA), std::move(endA), std::move(iterB), std::move(endB), std::move(a), std::move(b),
+        std::move(resultSelector)
+    };
+    // clang-format on
+}
+
+/**
+ * Performs an SQL-like inner join using a hash table. The keys returned by `a` and `b` are compared using `operator==` and
+ * hashed using `std::hash`. The table is built once, over `iterableA` if it is known to be smaller than `iterableB`, and over
+ * `iterableB` otherwise. The other sequence is probed lazily. Every pair of matching elements is returned, so duplicate keys on
+ * both sides are all joined with each other. Neither sequence needs to be sorted.
+ * @attention The order of the results follows the probed sequence. If the table is built over `iterableA`, the results are in
+ * the order of `iterableB`, otherwise in the order of `iterableA`.
+ * @param iterableA The sequence to join with `iterableB`.
+ * @param iterableB The sequence to join with `iterableA`.
+ * @param a A function that returns a hashable key of an element of `iterableA`.
+ * @param b A function that returns a hashable key of an element of `iterableB`.
+ * @param resultSelector A function with parameters `fn(decltype(iterableA[n]), decltype(iterableB[n]))`, which is called for
+ * every match. It may return anything, for e.g. `std::make_tuple(valueTypeA, valueTypeB)`.
+ * @return A hash join iterator view object, which can be used to iterate over.
+ */
+template<class IterableA, class IterableB, class SelectorA, class SelectorB, class ResultSelector>
+LZ_NODISCARD HashJoin<internal::IterTypeFromIterable<IterableA>, internal::IterTypeFromIterable<IterableB>, SelectorA, SelectorB,
+                      ResultSelector, false>
+hashJoin(IterableA&& iterableA, IterableB&& iterableB, SelectorA a, SelectorB b, ResultSelector resultSelector) {
+    return hashJoin(internal::begin(std::forward<IterableA>(iterableA)), internal::end(std::forward<IterableA>(iterableA)),
+                    internal::begin(std::forward<IterableB>(iterableB)), internal::end(std::forward<IterableB>(iterableB)),
+                    std::move(a), std::move(b), std::move(resultSelector));
+}
+
+/**
+ * Performs an SQL-like left outer join using a hash table built over sequence B. Sequence A is probed lazily and every element
+ * of A is returned at least once: once for every match in B, or once with a null pointer if there is no match. The keys are
+ * compared using `operator==` and hashed using `std::hash`.
+ * @param iterA The beginning of the sequence A to join.
+ * @param endA The ending of the sequence A to join.
+ * @param iterB The beginning of the sequence B to join.
+ * @param endB The ending of the sequence B to join.
+ * @param a A function that returns a hashable key of an element of A.
+ * @param b A function that returns a hashable key of an element of B.
+ * @param resultSelector A function with parameters `fn(decltype(*iterA), const value_type_b*)`. The pointer points to the
+ * matching element of B, or is `nullptr` if the element of A has no match. It may return anything.
+ * @return A hash join iterator view object, which can be used to iterate over.
+ */
+template<class IterA, class IterB, class SelectorA, class SelectorB, class ResultSelector>
+LZ_NODISCARD HashJoin<IterA, IterB, SelectorA, SelectorB, ResultSelector, true>
+leftHashJoin(IterA iterA, IterA endA, IterB iterB, IterB endB, SelectorA a, SelectorB b, ResultSelector resultSelector) {
+    // clang-format off
+    return {
+        std::move(iterA), std::move(endA), std::move(iterB), std::move(endB), std::move(a), std::move(b),
+        std::move(resultSelector)
+    };
+    // clang-format on
+}
+
+/**
+ * Performs an SQL-like left outer join using a hash table built over `iterableB`. `iterableA` is probed lazily and every element
+ * of it is returned at least once: once for every match in `iterableB`, or once with a null pointer if there is no match. The
+ * keys are compared using `operator==` and hashed using `std::hash`.
+ * @param iterableA The sequence to join with `iterableB`. Every element of it is returned at least once.
+ * @param iterableB The sequence to join with `iterableA`.
+ * @param a A function that returns a hashable key of an element of `iterableA`.
+ * @param b A function that returns a hashable key of an element of `iterableB`.
+ * @param resultSelector A function with parameters `fn(decltype(iterableA[n]), const value_type_b*)`. The pointer points to the
+ * matching element of `iterableB`, or is `nullptr` if the element of `iterableA` has no match. It may return anything.
+ * @return A hash join iterator view object, which can be used to iterate over.
+ */
+template<class IterableA, class IterableB, class SelectorA, class SelectorB, class ResultSelector>
+LZ_NODISCARD HashJoin<internal::IterTypeFromIterable<IterableA>, internal::IterTypeFromIterable<IterableB>, SelectorA, SelectorB,
+                      ResultSelector, true>
+leftHashJoin(IterableA&& iterableA, IterableB&& iterableB, SelectorA a, SelectorB b, ResultSelector resultSelector) {
+    return leftHashJoin(internal::begin(std::forward<IterableA>(iterableA)), internal::end(std::forward<IterableA>(iterableA)),
+                        internal::begin(std::forward<IterableB>(iterableB)), internal::end(std::forward<IterableB>(iterableB)),
+                        std::move(a), std::move(b), std::move(resultSelector));
+}
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_HASH_JOIN_HPP
@@ -0,0 +1,81 @@
+#pragma once
+
+#ifndef LZ_INPUT_STREAM_HPP
+#define LZ_INPUT_STREAM_HPP
+
+#include "detail/BasicIteratorView.hpp"
+#include "detail/InputStreamIterator.hpp"
+
+namespace lz {
+template<class Source, class SubString>
+class InputStreamLines final : public internal::BasicIteratorView<internal::InputStreamLineIterator<Source, SubString>> {
+public:
+    using iterator = internal::InputStreamLineIterator<Source, SubString>;
+    using const_iterator = iterator;
+    using value_type = std::string;
+
+    explicit InputStreamLines(std::shared_ptr<internal::BufferedReader<Source>> reader) :
+        internal::BasicIteratorView<iterator>(iterator(std::move(reader)), iterator()) {
+    }
+
+    InputStreamLines() = default;
+};
+
+template<class Source>
+class InputStream final : public internal::BasicIteratorView<internal::InputStreamIterator<Source>> {
+public:
+    using iterator = internal::InputStreamIterator<Source>;
+    using const_iterator = iterator;
+    using value_type = char;
+
+    InputStream(Source source, const std::size_t bufferSize) :
+        internal::BasicIteratorView<iterator>(
+            iterator(std::make_shared<internal::BufferedReader<Source>>(std::move(source), bufferSize)), iterator()) {
+    }
+
+    InputStream() = default;
+
+    /**
+     * @brief Returns a view over the lines of the input, instead of over its characters. The line feed and a carriage return
+     * before it are not part of the lines, and the last line does not need to end with a line feed. Both views share the same
+     * buffer, so the lines start at the first character that has not been read yet.
+     * @attention By default, the lines are `lz::StringView`s that point into the buffer, which is reused for every block that is
+     * read, so that no line has to be copied. Such a line is only valid until the iterator is incremented. The `value_type` of
+     * the view is always `std::string`, so collecting the lines (e.g. using `toVector()`) copies them.
+     * @tparam SubString The string type of the lines while iterating, `lz::StringView` by default. Use `std::string` to keep the
+     * lines after incrementing.
+     * @return An input iterator view over the lines of the input.
+     */
+    template<class SubString = StringView>
+    LZ_NODISCARD InputStreamLines<Source, SubString> lines() const {
+        return InputStreamLines<Source, SubString>(this->begin().reader());
+    }
+};
+
+// Start of group
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * @brief Returns an input iterator view over the characters of `stream`. The stream is read in blocks of `bufferSize` characters
+ * into a buffer that is reused, so that the whole stream never has to be in memory at once. Use `.lines()` to iterate over its
+ * lines instead.
+ * @details Nothing is read until the first character is requested. The stream must outlive the view.
+ * @param stream The stream to read, for e.g. `std::cin` or a `std::ifstream`.
+ * @param bufferSize The amount of characters to read at once.
+ * @return An input iterator view over the characters of `stream`, which can be converted to an arbitrary container or can be
+ * iterated over using `for (auto... lz::fromStream(...))`. Use `lz::fromFd` (Lz/FileDescriptor.hpp) to read a file descriptor.
+ */
+LZ_NODISCARD inline InputStream<internal::IstreamSource> fromStream(std::istream& stream, const std::size_t bufferSize = 65536) {
+    return { internal::IstreamSource(stream), bufferSize };
+}
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_INPUT_STREAM_HPP
@@ -14,16 +14,22 @@ public:
     using const_iterator = iterator;
     using value_type = typename iterator::value_type;
 
+private:
+    Join(Iterator begin, Iterator end, const std::shared_ptr<const internal::JoinFormat>& format) :
+        internal::BasicIteratorView<iterator>(iterator(std::move(begin), format, true), iterator(std::move(end), format, false)) {
+    }
+
+public:
+    // The delimiter and format are stored once, and shared by all iterators
 #    if defined(LZ_STANDALONE) && !defined(LZ_HAS_FORMAT)
-    LZ_CONSTEXPR_CXX_20 Join(Iterator begin, Iterator end, std::string delimiter) :
-        internal::BasicIteratorView<iterator>(iterator(std::move(begin), delimiter, true),
-                                              iterator(std::move(end), delimiter, false)) {
+    Join(Iterator begin, Iterator end, std::string delimiter) :
+        Join(std::move(begin), std::move(end),
+             std::make_shared<const internal::JoinFormat>(internal::JoinFormat{ std::move(delimiter), std::string() })) {
     }
 #    else
-    LZ_CONSTEXPR_CXX_20
     Join(Iterator begin, Iterator end, std::string delimiter, std::string fmt) :
-        internal::BasicIteratorView<iterator>(iterator(std::move(begin), delimiter, fmt, true),
-                                              iterator(std::move(end), delimiter, fmt, false)) {
+        Join(std::move(begin), std::move(end),
+             std::make_shared<const internal::JoinFormat>(internal::JoinFormat{ std::move(delimiter), std::move(fmt) })) {
     }
 #    endif // has format
 
@@ -45,7 +51,8 @@ public:
  * @brief Creates a Join object.
  * @note If you're going to call .toString() on this, it is better to use `strJoin` for performance reasons.
  * @details Combines the iterator values followed by the delimiter. It is evaluated in a
- * `"[value][delimiter][value][delimiter]..."`-like fashion.
+ * `"[value][delimiter][value][delimiter]..."`-like fashion. The values are formatted into a buffer in the iterator, and are
+ * returned as `lz::StringView`s that are valid until the iterator is changed or destroyed.
  * @param begin The beginning of the sequence.
  * @param end The ending of the sequence.
  * @param delimiter The delimiter to separate the previous and the next values in the sequence.
@@ -60,7 +67,8 @@ LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Join<Iterator> joinRange(Iterator begin, Iterat
  * @brief Creates a Join object.
  * @note If you're going to call .toString() on this, it is better to use `strJoin` for performance reasons.
  * @details Combines the iterator values followed by the delimiter. It is evaluated in a
- * `"[value][delimiter][value][delimiter]..."`-like fashion.
+ * `"[value][delimiter][value][delimiter]..."`-like fashion. The values are formatted into a buffer in the iterator, and are
+ * returned as `lz::StringView`s that are valid until the iterator is changed or destroyed.
  * @param iterable The iterable to join with the delimiter.
  * @param delimiter The delimiter to separate the previous and the next values in the sequence.
  * @return A Join iterator view object.
@@ -100,7 +108,8 @@ std::string strJoin(Iterable&& iterable, const StringView& delimiter = "") {
  * @brief Creates a Join object.
  * @note If you're going to call .toString() on this, it is better to use `strJoin` for performance reasons.
  * @details Combines the iterator values followed by the delimiter. It is evaluated in a
- * `"[value][delimiter][value][delimiter]..."`-like fashion.
+ * `"[value][delimiter][value][delimiter]..."`-like fashion. The values are formatted into a buffer in the iterator, and are
+ * returned as `lz::StringView`s that are valid until the iterator is changed or destroyed.
  * @param begin The beginning of the sequence.
  * @param end The ending of the sequence.
  * @param delimiter The delimiter to separate the previous and the next values in the sequence.
@@ -117,7 +126,8 @@ joinRange(Iterator begin, Iterator end, std::string delimiter, std::string fmt =
  * @brief Creates a Join object.
  * @note If you're going to call .toString() on this, it is better to use `strJoin` for performance reasons.
  * @details Combines the iterator values followed by the delimiter. It is evaluated in a
- * `"[value][delimiter][value][delimiter]..."`-like fashion.
+ * `"[value][delimiter][value][delimiter]..."`-like fashion. The values are formatted into a buffer in the iterator, and are
+ * returned as `lz::StringView`s that are valid until the iterator is changed or destroyed.
  * @param iterable The iterable to join with the delimiter.
  * @param delimiter The delimiter to separate the previous and the next values in the sequence.
  * @param fmt The std:: or fmt:: formatting args (`"{}"` is default).
@@ -154,6 +164,36 @@ std::string strJoin(Iterable&& iterable, const StringView& delimiter = "", const
     return strJoinRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
                         delimiter, fmt);
 }
+
+#        if !defined(LZ_STANDALONE)
+/**
+ * Converts a sequence to a `std::string` without creating an iterator Join object. The format string is parsed at compile time.
+ * @param begin The beginning of the sequence
+ * @param end The ending of the sequence
+ * @param delimiter The delimiter to separate each value from the sequence.
+ * @param fmt The format string, compiled using `FMT_COMPILE`, for e.g. `FMT_COMPILE("{:.2f}")`.
+ * @return A string where each item in `iterable` is appended to a string, separated by `delimiter`.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class CompiledFormat,
+         internal::EnableIf<internal::IsCompiledFormat<CompiledFormat>::value, int> = 0>
+std::string strJoinRange(Iterator begin, Iterator end, const StringView& delimiter, const CompiledFormat& fmt) {
+    return internal::BasicIteratorView<Iterator>(std::move(begin), std::move(end)).toString(delimiter, fmt);
+}
+
+/**
+ * Converts a sequence to a `std::string` without creating an iterator Join object. The format string is parsed at compile time.
+ * @param iterable The iterable to convert to string
+ * @param delimiter The delimiter to separate each value from the sequence.
+ * @param fmt The format string, compiled using `FMT_COMPILE`, for e.g. `FMT_COMPILE("{:.2f}")`.
+ * @return A string where each item in `iterable` is appended to a string, separated by `delimiter`.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class CompiledFormat,
+         internal::EnableIf<internal::IsCompiledFormat<CompiledFormat>::value, int> = 0>
+std::string strJoin(Iterable&& iterable, const StringView& delimiter, const CompiledFormat& fmt) {
+    return strJoinRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                        delimiter, fmt);
+}
+#        endif // LZ_STANDALONE
 #    endif // has format
 
 // End of group
@@ -54,7 +54,10 @@ public:
  * `resultSelector` if those are equal. The selector for a must be a function with a parameter of type = `*iterA`. The selector
  * for b must be a function with a parameter of type = `*iterB`. The selector for the result must be a function with parameters:
  * `fn(decltype(*iterA), decltype(*iterB)`. It may return anything.
- * @attention [iterB, endB) must be sorted in order to work correctly.
+ * @attention [iterB, endB) must be sorted in order to work correctly. If [iterA, endA) is sorted by key as well, the sequences are
+ * merged with a galloping search that only moves forward through B, which takes O(n + m) for sequences of similar size and
+ * O(n log(m / n)) if B is much larger than A. Otherwise, B is searched from the beginning whenever a key of A is smaller than
+ * the previous one.
  * @param iterA The beginning of the sequence A to join.
  * @param endA The ending of the sequence A to join.
  * @param iterB The beginning of the sequence B to join.
@@ -64,7 +67,8 @@ public:
  * @param resultSelector A function that takes two parameters as its arguments. The value type of iterator a and the value type
  * of iterator b. Once a match of `a == b` is found, this function will be called, and a result can be returned, for e.g.
  * `std::make_tuple(valueTypeA, valueTypeB)`.
- * @param execution The execution policy. Must be any of std::execution::*
+ * @param execution The execution policy. Must be any of std::execution::* or a `lz::ThreadPoolExecutor`. With a parallel
+ * policy and random access sequences, converting the join to a container evaluates the join in parallel blocks.
  * @return A join where iterator view object, which can be used to iterate over.
  */
 template<class IterA, class IterB, class SelectorA, class SelectorB, class ResultSelector,
@@ -85,7 +89,10 @@ joinWhere(IterA iterA, IterA endA, IterB iterB, IterB endB, SelectorA a, Selecto
  * `resultSelector` if those are equal. The selector for a must be a function with a parameter of type = `decltype(iterableA[n])`.
  * The selector for b must be a function with a parameter of type = `decltype(iterableB[n])`. The selector for the result must be
  * a function with parameters: `fn(decltype(iterableA[n]), decltype(iterableB[n])`. It may return anything.
- * @attention iterableB must be sorted in order to work correctly.
+ * @attention iterableB must be sorted in order to work correctly. If iterableA is sorted by key as well, the sequences are merged
+ * with a galloping search that only moves forward through iterableB, which takes O(n + m) for sequences of similar size and
+ * O(n log(m / n)) if iterableB is much larger than iterableA. Otherwise, iterableB is searched from the beginning whenever a key
+ * of iterableA is smaller than the previous one.
  * @param iterableA The sequence to join with `iterableB`.
  * @param iterableB The sequence to join with `iterableA`.
  * @param a A function that returns a key-like value to compare the result of `b` with.
@@ -93,7 +100,8 @@ joinWhere(IterA iterA, IterA endA, IterB iterB, IterB endB, SelectorA a, Selecto
  * @param resultSelector A function that takes two parameters as its arguments. The value type of iterable `iterableA` and the
  * value type of iterable `iterableB`. Once a match of `a == b` is found, this function will be called, and a result can be
  * returned, for e.g. `std::make_tuple(valueTypeA, valueTypeB)`.
- * @param execution The execution policy. Must be any of std::execution::*
+ * @param execution The execution policy. Must be any of std::execution::* or a `lz::ThreadPoolExecutor`. With a parallel
+ * policy and random access sequences, converting the join to a container evaluates the join in parallel blocks.
  * @return A join where iterator view object, which can be used to iterate over.
  */
 template<class IterableA, class IterableB, class SelectorA, class SelectorB, class ResultSelector,
@@ -112,7 +120,10 @@ joinWhere(IterableA&& iterableA, IterableB&& iterableB, SelectorA a, SelectorB b
  * `resultSelector` if those are equal. The selector for a must be a function with a parameter of type = `*iterA`. The selector
  * for b must be a function with a parameter of type = `*iterB`. The selector for the result must be a function with parameters:
  * `fn(decltype(*iterA), decltype(*iterB)`. It may return anything.
- * @attention [iterB, endB) must be sorted in order to work correctly.
+ * @attention [iterB, endB) must be sorted in order to work correctly. If [iterA, endA) is sorted by key as well, the sequences are
+ * merged with a galloping search that only moves forward through B, which takes O(n + m) for sequences of similar size and
+ * O(n log(m / n)) if B is much larger than A. Otherwise, B is searched from the beginning whenever a key of A is smaller than
+ * the previous one.
  * @param iterA The beginning of the sequence A to join.
  * @param endA The ending of the sequence A to join.
  * @param iterB The beginning of the sequence B to join.
@@ -140,7 +151,10 @@ joinWhere(IterA iterA, IterA endA, IterB iterB, IterB endB, SelectorA a, Selecto
  * `resultSelector` if those are equal. The selector for a must be a function with a parameter of type = `decltype(iterableA[n])`.
  * The selector for b must be a function with a parameter of type = `decltype(iterableB[n])`. The selector for the result must be
  * a function with parameters: `fn(decltype(iterableA[n]), decltype(iterableB[n])`. It may return anything.
- * @attention iterableB must be sorted in order to work correctly.
+ * @attention iterableB must be sorted in order to work correctly. If iterableA is sorted by key as well, the sequences are merged
+ * with a galloping search that only moves forward through iterableB, which takes O(n + m) for sequences of similar size and
+ * O(n log(m / n)) if iterableB is much larger than iterableA. Otherwise, iterableB is searched from the beginning whenever a key
+ * of iterableA is smaller than the previous one.
  * @param iterableA The sequence to join with `iterableB`.
  * @param iterableB The sequence to join with `iterableA`.
  * @param a A function that returns a key-like value to compare the result of `b` with.
@@ -6,6 +6,7 @@
 #    include "Lz/CartesianProduct.hpp"
 #    include "Lz/ChunkIf.hpp"
 #    include "Lz/Chunks.hpp"
+#    include "Lz/Csv.hpp"
 #    include "Lz/Enumerate.hpp"
 #    include "Lz/Except.hpp"
 #    include "Lz/Exclude.hpp"
@@ -13,11 +14,15 @@
 #    include "Lz/FunctionTools.hpp"
 #    include "Lz/Generate.hpp"
 #    include "Lz/GroupBy.hpp"
+#    include "Lz/HashJoin.hpp"
+#    include "Lz/InputStream.hpp"
 #    include "Lz/JoinWhere.hpp"
+#    include "Lz/Parse.hpp"
 #    include "Lz/Random.hpp"
 #    include "Lz/Range.hpp"
 #    include "Lz/Repeat.hpp"
 #    include "Lz/TakeEvery.hpp"
+#    include "Lz/ThreadPool.hpp"
 #    include "Lz/Unique.hpp"
 // Function tools includes:
 // Concatenate.hpp
@@ -29,18 +34,68 @@
 // Zip.hpp
 
 namespace lz {
-#    ifndef LZ_HAS_CXX_EXECUTION
 namespace internal {
-template<class Iterator, class T, class BinOp>
-T accumulate(Iterator begin, Iterator end, T init, BinOp binOp) {
-    while (begin != end) {
-        init = binOp(std::move(init), *begin);
-        ++begin;
+// The functions below push every element into a callback using `forEachUntil` instead of pulling them one by one using
+// `operator++` and `operator!=`. This lets adaptors such as filter, flatten and concatenate run their own inner loops.
+template<class UnaryPredicate>
+struct NotFn {
+    UnaryPredicate predicate;
+
+    template<class T>
+    LZ_CONSTEXPR_CXX_20 bool operator()(T&& value) {
+        return !predicate(std::forward<T>(value));
+    }
+};
+
+template<class T>
+struct EqualTo {
+    const T& value;
+
+    template<class U>
+    constexpr bool operator()(const U& other) const {
+        return other == value;
     }
+};
+
+template<class Iterator, class T, class BinOp>
+LZ_CONSTEXPR_CXX_20 T accumulate(Iterator begin, Iterator end, T init, BinOp binOp) {
+    using Ref = RefType<Iterator>;
+    forEachUntil(std::move(begin), std::move(end), [&init, &binOp](Ref value) {
+        init = binOp(std::move(init), std::forward<Ref>(value));
+        return false;
+    });
     return init;
 }
+
+template<class Iterator, class UnaryFunc>
+LZ_CONSTEXPR_CXX_20 void forEach(Iterator begin, Iterator end, UnaryFunc func) {
+    using Ref = RefType<Iterator>;
+    forEachUntil(std::move(begin), std::move(end), [&func](Ref value) {
+        func(std::forward<Ref>(value));
+        return false;
+    });
+}
+
+template<class Iterator, class UnaryPredicate>
+LZ_CONSTEXPR_CXX_20 bool anyOf(Iterator begin, Iterator end, UnaryPredicate predicate) {
+    using Ref = RefType<Iterator>;
+    return forEachUntil(std::move(begin), std::move(end),
+                        [&predicate](Ref value) { return static_cast<bool>(predicate(std::forward<Ref>(value))); });
+}
+
+template<class Iterator, class UnaryPredicate>
+LZ_CONSTEXPR_CXX_20 DiffType<Iterator> countIf(Iterator begin, Iterator end, UnaryPredicate predicate) {
+    using Ref = RefType<Iterator>;
+    DiffType<Iterator> count = 0;
+    forEachUntil(std::move(begin), std::move(end), [&predicate, &count](Ref value) {
+        if (predicate(std::forward<Ref>(value))) {
+            ++count;
+        }
+        return false;
+    });
+    return count;
+}
 } // namespace internal
-#    endif // LZ_HAS_CXX_EXECUTION
 
 template<LZ_CONCEPT_ITERATOR Iterator>
 class IterView;
@@ -179,6 +234,18 @@ public:
         return toIter(lz::as<T>(*this));
     }
 
+    //! See Parse.hpp `parse` for documentation.
+    template<class T>
+    LZ_NODISCARD IterView<internal::MapIterator<Iterator, internal::ParseFn<T>>> parseAs() const {
+        return toIter(lz::parse<T>(*this));
+    }
+
+    //! See Parse.hpp `parseValid` for documentation.
+    template<class T>
+    LZ_NODISCARD IterView<internal::ParseValidIterator<Iterator, T>> parseValidAs() const {
+        return toIter(lz::parseValid<T>(*this));
+    }
+
     //! See FunctionTools.hpp `reverse` for documentation.
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<std::reverse_iterator<Iterator>> reverse() const {
         return toIter(lz::reverse(*this));
@@ -197,6 +264,22 @@ public:
         return toIter(lz::cartesian(*this, std::forward<Iterables>(iterables)...));
     }
 
+    //! See HashJoin.hpp for documentation
+    template<class IterableB, class SelectorA, class SelectorB, class ResultSelector>
+    LZ_NODISCARD IterView<internal::HashJoinIterator<Iterator, internal::IterTypeFromIterable<IterableB>, SelectorA, SelectorB,
+                                                     ResultSelector, false>>
+    hashJoin(IterableB&& iterableB, SelectorA a, SelectorB b, ResultSelector resultSelector) const {
+        return toIter(lz::hashJoin(*this, iterableB, std::move(a), std::move(b), std::move(resultSelector)));
+    }
+
+    //! See HashJoin.hpp for documentation
+    template<class IterableB, class SelectorA, class SelectorB, class ResultSelector>
+    LZ_NODISCARD IterView<internal::HashJoinIterator<Iterator, internal::IterTypeFromIterable<IterableB>, SelectorA, SelectorB,
+                                                     ResultSelector, true>>
+    leftHashJoin(IterableB&& iterableB, SelectorA a, SelectorB b, ResultSelector resultSelector) const {
+        return toIter(lz::leftHashJoin(*this, iterableB, std::move(a), std::move(b), std::move(resultSelector)));
+    }
+
     //! See Flatten.hpp for documentation
     template<int N = lz::internal::CountDims<std::iterator_traits<Iterator>>::value - 1>
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::FlattenIterator<Iterator, N>> flatten() const {
@@ -400,10 +483,10 @@ public:
     LZ_CONSTEXPR_CXX_20 IterView<Iterator>& forEach(UnaryFunc func, Execution execution = std::execution::seq) {
         if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
             static_cast<void>(execution);
-            std::for_each(Base::begin(), Base::end(), std::move(func));
+            internal::forEach(Base::begin(), Base::end(), std::move(func));
         }
         else {
-            std::for_each(execution, Base::begin(), Base::end(), std::move(func));
+            internal::forEach(execution, Base::begin(), Base::end(), std::move(func));
         }
         return *this;
     }
@@ -418,10 +501,10 @@ public:
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 T foldl(T&& init, BinaryFunction function, Execution execution = std::execution::seq) const {
         if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
             static_cast<void>(execution);
-            return std::reduce(Base::begin(), Base::end(), std::forward<T>(init), std::move(function));
+            return internal::accumulate(Base::begin(), Base::end(), std::forward<T>(init), std::move(function));
         }
         else {
-            return std::reduce(execution, Base::begin(), Base::end(), std::forward<T>(init), std::move(function));
+            return internal::reduce(execution, Base::begin(), Base::end(), std::forward<T>(init), std::move(function));
         }
     }
 
@@ -436,11 +519,11 @@ public:
         auto reverseView = reverse();
         if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
             static_cast<void>(execution);
-            return std::reduce(internal::begin(std::move(reverseView)), internal::end(std::move(reverseView)),
-                               std::forward<T>(init), std::move(function));
+            return internal::accumulate(internal::begin(std::move(reverseView)), internal::end(std::move(reverseView)),
+                                        std::forward<T>(init), std::move(function));
         }
         else {
-            return std::reduce(execution, internal::begin(std::move(reverseView)), internal::end(std::move(reverseView)),
+            return internal::reduce(execution, internal::begin(std::move(reverseView)), internal::end(std::move(reverseView)),
                                std::forward<T>(init), std::move(function));
         }
     }
@@ -468,7 +551,7 @@ public:
             return *std::max_element(Base::begin(), Base::end(), std::move(cmp));
         }
         else {
-            return *std::max_element(execution, Base::begin(), Base::end(), std::move(cmp));
+            return *internal::maxElement(execution, Base::begin(), Base::end(), std::move(cmp));
         }
     }
 
@@ -486,7 +569,7 @@ public:
             return *std::min_element(Base::begin(), Base::end(), std::move(cmp));
         }
         else {
-            return *std::min_element(execution, Base::begin(), Base::end(), std::move(cmp));
+            return *internal::minElement(execution, Base::begin(), Base::end(), std::move(cmp));
         }
     }
 
@@ -512,10 +595,10 @@ public:
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 bool all(UnaryPredicate predicate, Execution execution = std::execution::seq) const {
         if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
             static_cast<void>(execution);
-            return std::all_of(Base::begin(), Base::end(), std::move(predicate));
+            return !internal::anyOf(Base::begin(), Base::end(), internal::NotFn<UnaryPredicate>{ std::move(predicate) });
         }
         else {
-            return std::all_of(execution, Base::begin(), Base::end(), std::move(predicate));
+            return internal::allOf(execution, Base::begin(), Base::end(), std::move(predicate));
         }
     }
 
@@ -529,10 +612,10 @@ public:
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 bool any(UnaryPredicate predicate, Execution execution = std::execution::seq) const {
         if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
             static_cast<void>(execution);
-            return std::any_of(Base::begin(), Base::end(), std::move(predicate));
+            return internal::anyOf(Base::begin(), Base::end(), std::move(predicate));
         }
         else {
-            return std::any_of(execution, Base::begin(), Base::end(), std::move(predicate));
+            return internal::anyOf(execution, Base::begin(), Base::end(), std::move(predicate));
         }
     }
 
@@ -546,10 +629,10 @@ public:
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 bool none(UnaryPredicate predicate, Execution execution = std::execution::seq) {
         if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
             static_cast<void>(execution);
-            return std::none_of(Base::begin(), Base::end(), std::move(predicate));
+            return !internal::anyOf(Base::begin(), Base::end(), std::move(predicate));
         }
         else {
-            return std::none_of(execution, Base::begin(), Base::end(), std::move(predicate));
+            return internal::noneOf(execution, Base::begin(), Base::end(), std::move(predicate));
         }
     }
 
@@ -562,10 +645,10 @@ public:
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 difference_type count(const T& value, Execution execution = std::execution::seq) const {
         if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
             static_cast<void>(execution);
-            return std::count(Base::begin(), Base::end(), value);
+            return internal::countIf(Base::begin(), Base::end(), internal::EqualTo<T>{ value });
         }
         else {
-            return std::count(execution, Base::begin(), Base::end(), value);
+            return internal::count(execution, Base::begin(), Base::end(), value);
         }
     }
 
@@ -579,10 +662,10 @@ public:
                                                              Execution execution = std::execution::seq) const {
         if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
             static_cast<void>(execution);
-            return std::count_if(Base::begin(), Base::end(), std::move(predicate));
+            return internal::countIf(Base::begin(), Base::end(), std::move(predicate));
         }
         else {
-            return std::count_if(execution, Base::begin(), Base::end(), std::move(predicate));
+            return internal::countIf(execution, Base::begin(), Base::end(), std::move(predicate));
         }
     }
 
@@ -593,12 +676,12 @@ public:
      */
     template<class BinaryPredicate = std::less<>, class Execution = std::execution::sequenced_policy>
     LZ_CONSTEXPR_CXX_20 IterView<Iterator>& sort(BinaryPredicate predicate = {}, Execution execution = std::execution::seq) {
-        if constexpr (internal::checkForwardAndPolicies<Execution, IterView>()) {
+        if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
             static_cast<void>(execution);
             std::sort(Base::begin(), Base::end(), std::move(predicate));
         }
         else {
-            std::sort(execution, Base::begin(), Base::end(), std::move(predicate));
+            internal::sort(execution, Base::begin(), Base::end(), std::move(predicate));
         }
         return *this;
     }
@@ -616,7 +699,7 @@ public:
             return std::is_sorted(Base::begin(), Base::end(), std::move(predicate));
         }
         else {
-            return std::is_sorted(execution, Base::begin(), Base::end(), std::move(predicate));
+            return internal::isSorted(execution, Base::begin(), Base::end(), std::move(predicate));
         }
     }
 #    else // ^^^ lz has execution vvv ! lz has execution
@@ -774,7 +857,7 @@ public:
      */
     template<class UnaryFunc>
     IterView<Iterator>& forEach(UnaryFunc func) {
-        std::for_each(Base::begin(), Base::end(), std::move(func));
+        internal::forEach(Base::begin(), Base::end(), std::move(func));
         return *this;
     }
 
@@ -870,7 +953,7 @@ public:
      */
     template<class UnaryPredicate>
     bool all(UnaryPredicate predicate) const {
-        return std::all_of(Base::begin(), Base::end(), std::move(predicate));
+        return !internal::anyOf(Base::begin(), Base::end(), internal::NotFn<UnaryPredicate>{ std::move(predicate) });
     }
 
     /**
@@ -880,7 +963,7 @@ public:
      */
     template<class UnaryPredicate>
     bool any(UnaryPredicate predicate) const {
-        return std::any_of(Base::begin(), Base::end(), std::move(predicate));
+        return internal::anyOf(Base::begin(), Base::end(), std::move(predicate));
     }
 
     /**
@@ -890,7 +973,7 @@ public:
      */
     template<class UnaryPredicate>
     bool none(UnaryPredicate predicate) const {
-        return std::none_of(Base::begin(), Base::end(), std::move(predicate));
+        return !internal::anyOf(Base::begin(), Base::end(), std::move(predicate));
     }
 
     /**
@@ -900,7 +983,7 @@ public:
      */
     template<class T>
     difference_type count(const T& value) const {
-        return std::count(Base::begin(), Base::end(), value);
+        return internal::countIf(Base::begin(), Base::end(), internal::EqualTo<T>{ value });
     }
 
     /**
@@ -910,7 +993,7 @@ public:
      */
     template<class UnaryPredicate>
     difference_type countIf(UnaryPredicate predicate) const {
-        return std::count_if(Base::begin(), Base::end(), std::move(predicate));
+        return internal::countIf(Base::begin(), Base::end(), std::move(predicate));
     }
 
     /**
@@ -0,0 +1,272 @@
+#pragma once
+
+#ifndef LZ_MAPPED_FILE_HPP
+#define LZ_MAPPED_FILE_HPP
+
+#include "detail/BasicIteratorView.hpp"
+#include "detail/LinesIterator.hpp"
+
+#if defined(_WIN32)
+// Keeps the `min` and `max` macros (which break e.g. `std::max(a, b)`) and the rarely used parts of windows.h out of the code
+// that includes this header
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#        define LZ_UNDEF_NOMINMAX
+#    endif // NOMINMAX
+#    ifndef WIN32_LEAN_AND_MEAN
+#        define WIN32_LEAN_AND_MEAN
+#        define LZ_UNDEF_WIN32_LEAN_AND_MEAN
+#    endif // WIN32_LEAN_AND_MEAN
+#    include <windows.h>
+#    ifdef LZ_UNDEF_NOMINMAX
+#        undef NOMINMAX
+#        undef LZ_UNDEF_NOMINMAX
+#    endif // LZ_UNDEF_NOMINMAX
+#    ifdef LZ_UNDEF_WIN32_LEAN_AND_MEAN
+#        undef WIN32_LEAN_AND_MEAN
+#        undef LZ_UNDEF_WIN32_LEAN_AND_MEAN
+#    endif // LZ_UNDEF_WIN32_LEAN_AND_MEAN
+#    define LZ_HAS_MAPPED_FILE
+#elif defined(__unix__) || defined(__APPLE__)
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#    define LZ_HAS_MAPPED_FILE
+#endif // _WIN32
+
+#ifdef LZ_HAS_MAPPED_FILE
+#    include <cerrno>
+#    include <system_error>
+
+namespace lz {
+/**
+ * A read only, memory mapped file. The bytes of the file can be iterated over as `const char`s, or be split into lines using
+ * `lz::lines`, without reading the file into a buffer first. The mapping is released when the object is destroyed, so it must
+ * outlive every view that refers to it. This header includes the headers of the operating system, so it is not part of
+ * `Lz/Lz.hpp` and must be included separately.
+ */
+class MappedFile {
+    const char* _data{ nullptr };
+    std::size_t _size{};
+
+    void unmap() noexcept {
+        if (_data == nullptr) {
+            return;
+        }
+#    if defined(_WIN32)
+        ::UnmapViewOfFile(_data);
+#    else
+        ::munmap(const_cast<char*>(_data), _size);
+#    endif // _WIN32
+        _data = nullptr;
+        _size = 0;
+    }
+
+#    if defined(_WIN32)
+    // `error` must be obtained before calling other functions (like `CloseHandle`) that may overwrite the last error
+    [[noreturn]] static void fail(const DWORD error, const std::string& path) {
+        throw std::system_error(static_cast<int>(error), std::system_category(), "lz::mmapFile: " + path);
+    }
+
+    void map(const std::string& path) {
+        const HANDLE file = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                          FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            fail(::GetLastError(), path);
+        }
+        LARGE_INTEGER size;
+        if (!::GetFileSizeEx(file, &size)) {
+            const DWORD error = ::GetLastError();
+            ::CloseHandle(file);
+            fail(error, path);
+        }
+        if (size.QuadPart == 0) {
+            // Empty files cannot be mapped
+            ::CloseHandle(file);
+            return;
+        }
+        // The view keeps the mapping alive, so both handles can be closed right away
+        const HANDLE mapping = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        DWORD error = ::GetLastError();
+        ::CloseHandle(file);
+        if (mapping == nullptr) {
+            fail(error, path);
+        }
+        const void* view = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        error = ::GetLastError();
+        ::CloseHandle(mapping);
+        if (view == nullptr) {
+            fail(error, path);
+        }
+        _data = static_cast<const char*>(view);
+        _size = static_cast<std::size_t>(size.QuadPart);
+    }
+#    else
+    [[noreturn]] static void fail(const std::string& path) {
+        throw std::system_error(errno, std::generic_category(), "lz::mmapFile: " + path);
+    }
+
+    void map(const std::string& path) {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd == -1) {
+            fail(path);
+        }
+        struct stat status {};
+        if (::fstat(fd, &status) == -1) {
+            const int error = errno;
+            ::close(fd);
+            errno = error;
+            fail(path);
+        }
+        if (status.st_size == 0) {
+            // Empty files cannot be mapped
+            ::close(fd);
+            return;
+        }
+        const auto size = static_cast<std::size_t>(status.st_size);
+        void* view = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        const int error = errno;
+        // The mapping keeps the file alive, so the descriptor can be closed right away
+        ::close(fd);
+        if (view == MAP_FAILED) {
+            errno = error;
+            fail(path);
+        }
+        // Only a hint to read ahead more aggressively, so failing is harmless
+        ::madvise(view, size, MADV_SEQUENTIAL);
+        _data = static_cast<const char*>(view);
+        _size = size;
+    }
+#    endif // _WIN32
+
+public:
+    using value_type = char;
+    using iterator = const char*;
+    using const_iterator = iterator;
+
+    /**
+     * Maps the file at `path` into memory.
+     * @param path The path of the file to map.
+     * @throws std::system_error If the file cannot be opened or mapped.
+     */
+    explicit MappedFile(const std::string& path) {
+        map(path);
+    }
+
+    MappedFile() = default;
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept : _data(other._data), _size(other._size) {
+        other._data = nullptr;
+        other._size = 0;
+    }
+
+    MappedFile& operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            unmap();
+            _data = other._data;
+            _size = other._size;
+            other._data = nullptr;
+            other._size = 0;
+        }
+        return *this;
+    }
+
+    ~MappedFile() {
+        unmap();
+    }
+
+    LZ_NODISCARD const char* data() const noexcept {
+        return _data;
+    }
+
+    LZ_NODISCARD std::size_t size() const noexcept {
+        return _size;
+    }
+
+    LZ_NODISCARD bool empty() const noexcept {
+        return _size == 0;
+    }
+
+    LZ_NODISCARD iterator begin() const noexcept {
+        return _data;
+    }
+
+    LZ_NODISCARD iterator end() const noexcept {
+        return _data + _size;
+    }
+};
+
+template<class SubString>
+class Lines final : public internal::BasicIteratorView<internal::LinesIterator<SubString>> {
+public:
+    using iterator = internal::LinesIterator<SubString>;
+    using const_iterator = iterator;
+    using value_type = SubString;
+
+    Lines(const char* data, const std::size_t size) :
+        internal::BasicIteratorView<iterator>(iterator(0, data, size), iterator(size, data, size)) {
+    }
+
+    Lines() = default;
+};
+
+// Start of group
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * @brief Maps the file at `path` into memory (read only), and advises the operating system that it will be read sequentially.
+ * @details Use `lz::lines(file)` to iterate over its lines, or `lz::toIter(file)` to iterate over its bytes.
+ * @param path The path of the file to map.
+ * @return A MappedFile object. The mapping is released when it is destroyed, so it must outlive every view that refers to it.
+ * @throws std::system_error If the file cannot be opened or mapped.
+ */
+LZ_NODISCARD inline MappedFile mmapFile(const std::string& path) {
+    return MappedFile(path);
+}
+
+#    if defined(LZ_HAS_STRING_VIEW)
+template<class SubString = std::string_view>
+#    elif defined(LZ_STANDALONE)
+template<class SubString = std::string>
+#    else
+template<class SubString = fmt::string_view>
+#    endif
+/**
+ * @brief Splits a memory mapped file into lines, without copying them. The line feed and a carriage return before it are not
+ * part of the lines, and the last line does not need to end with a line feed.
+ * @tparam SubString The string type of the lines. If C++17, this will default to `std::string_view`. If `LZ_STANDALONE` is not
+ * defined and C++17 is not defined, this will default to `std::string`. Otherwise it will default to `fmt::string_view`.
+ * Furthermore, `SubString` should have a constructor which looks like `SubString(const char*, std::size_t length)`.
+ * @param file The memory mapped file to split.
+ * @return A Lines object that can be converted to an arbitrary container or can be iterated over using
+ * `for (auto... lz::lines(...))`.
+ */
+LZ_NODISCARD Lines<SubString> lines(const MappedFile& file) {
+    return { file.data(), file.size() };
+}
+
+#    if defined(LZ_HAS_STRING_VIEW)
+template<class SubString = std::string_view>
+#    elif defined(LZ_STANDALONE)
+template<class SubString = std::string>
+#    else
+template<class SubString = fmt::string_view>
+#    endif
+Lines<SubString> lines(MappedFile&& file) = delete;
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_HAS_MAPPED_FILE
+
+#endif // LZ_MAPPED_FILE_HPP
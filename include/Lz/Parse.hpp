@@ -0,0 +1,98 @@
+#pragma once
+
+#ifndef LZ_PARSE_HPP
+#define LZ_PARSE_HPP
+
+#include "Map.hpp"
+#include "detail/BasicIteratorView.hpp"
+#include "detail/ParseIterator.hpp"
+
+namespace lz {
+template<LZ_CONCEPT_ITERATOR Iterator, class T>
+class ParseValid final : public internal::BasicIteratorView<internal::ParseValidIterator<Iterator, T>> {
+public:
+    using iterator = internal::ParseValidIterator<Iterator, T>;
+    using const_iterator = iterator;
+    using value_type = T;
+
+    ParseValid(Iterator begin, Iterator end) : internal::BasicIteratorView<iterator>(iterator(begin, end), iterator(end, end)) {
+    }
+
+    ParseValid() = default;
+};
+
+// Start of group
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * @brief Parses every string of [begin, end) as a `T`, without copying or allocating. Uses `std::from_chars` if available, and
+ * a hand written parser (integers) or `std::strto*` (floating points) otherwise.
+ * @details The strings must have `data()` and `size()`, like the `std::string_view`s that `lz::split` returns. Like
+ * `std::from_chars`, leading whitespace and a plus sign are not accepted, and the whole string must be a number. No exceptions
+ * are thrown: every element is a `lz::ParseResult<T>`, of which `error` tells whether and why the parse failed. Use
+ * `lz::parseValid` to skip the strings that cannot be parsed instead.
+ * @tparam T An arithmetic type to parse, other than `bool`.
+ * @param begin The beginning of the strings to parse.
+ * @param end The ending of the strings to parse.
+ * @return A random access (if `Iterator` is random access) Map object, that can be converted to an arbitrary container or can be
+ * iterated over using `for (auto... lz::parse<T>(...))`.
+ */
+template<class T, LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD Map<Iterator, internal::ParseFn<T>> parse(Iterator begin, Iterator end) {
+    return mapRange(std::move(begin), std::move(end), internal::ParseFn<T>());
+}
+
+/**
+ * @brief Parses every string of `iterable` as a `T`, without copying or allocating. Uses `std::from_chars` if available, and a
+ * hand written parser (integers) or `std::strto*` (floating points) otherwise.
+ * @details The strings must have `data()` and `size()`, like the `std::string_view`s that `lz::split` returns. Like
+ * `std::from_chars`, leading whitespace and a plus sign are not accepted, and the whole string must be a number. No exceptions
+ * are thrown: every element is a `lz::ParseResult<T>`, of which `error` tells whether and why the parse failed. Use
+ * `lz::parseValid` to skip the strings that cannot be parsed instead.
+ * @tparam T An arithmetic type to parse, other than `bool`.
+ * @param iterable The strings to parse, for e.g. `lz::split(line, ',')`.
+ * @return A random access (if `iterable` is random access) Map object, that can be converted to an arbitrary container or can be
+ * iterated over using `for (auto... lz::parse<T>(...))`.
+ */
+template<class T, LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD Map<internal::IterTypeFromIterable<Iterable>, internal::ParseFn<T>> parse(Iterable&& iterable) {
+    return parse<T>(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)));
+}
+
+/**
+ * @brief Parses every string of [begin, end) as a `T` (see `lz::parse`), and skips the strings that cannot be parsed. Every
+ * string is parsed only once.
+ * @tparam T An arithmetic type to parse, other than `bool`.
+ * @param begin The beginning of the strings to parse.
+ * @param end The ending of the strings to parse.
+ * @return A forward (if `Iterator` is at least forward) ParseValid object of `T`s, that can be converted to an arbitrary
+ * container or can be iterated over using `for (auto... lz::parseValid<T>(...))`.
+ */
+template<class T, LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD ParseValid<Iterator, T> parseValid(Iterator begin, Iterator end) {
+    return { std::move(begin), std::move(end) };
+}
+
+/**
+ * @brief Parses every string of `iterable` as a `T` (see `lz::parse`), and skips the strings that cannot be parsed. Every string
+ * is parsed only once.
+ * @tparam T An arithmetic type to parse, other than `bool`.
+ * @param iterable The strings to parse, for e.g. `lz::split(line, ',')`.
+ * @return A forward (if `iterable` is at least forward) ParseValid object of `T`s, that can be converted to an arbitrary
+ * container or can be iterated over using `for (auto... lz::parseValid<T>(...))`.
+ */
+template<class T, LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD ParseValid<internal::IterTypeFromIterable<Iterable>, T> parseValid(Iterable&& iterable) {
+    return parseValid<T>(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)));
+}
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_PARSE_HPP
@@ -6,8 +6,13 @@
 #    include "detail/BasicIteratorView.hpp"
 #    include "detail/RandomIterator.hpp"
 
+#    include <cstdint>
 #    include <random>
 
+#    if defined(_MSC_VER) && defined(_M_X64) && !defined(__SIZEOF_INT128__)
+#        include <intrin.h>
+#    endif // _MSC_VER
+
 namespace lz {
 namespace internal {
 template<std::size_t N>
@@ -117,12 +122,184 @@ inline std::mt19937 createMtEngine() {
     SeedSequence<8> seedSeq(rd);
     return std::mt19937(seedSeq);
 }
+
+constexpr std::uint64_t rotateLeft(const std::uint64_t x, const unsigned k) noexcept {
+    return (x << k) | (x >> ((64 - k) & 63));
+}
+
+constexpr std::uint64_t rotateRight(const std::uint64_t x, const unsigned k) noexcept {
+    return (x >> k) | (x << ((64 - k) & 63));
+}
+
+// The upper 64 bits of the 128 bit product of `a` and `b`
+inline std::uint64_t multiplyHigh(const std::uint64_t a, const std::uint64_t b) noexcept {
+#    if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 UInt128;
+    return static_cast<std::uint64_t>((static_cast<UInt128>(a) * b) >> 64);
+#    elif defined(_MSC_VER) && defined(_M_X64)
+    return __umulh(a, b);
+#    else
+    const std::uint64_t aLow = a & 0xFFFFFFFF, aHigh = a >> 32;
+    const std::uint64_t bLow = b & 0xFFFFFFFF, bHigh = b >> 32;
+    const std::uint64_t lowHigh = aLow * bHigh, highLow = aHigh * bLow;
+    const std::uint64_t middle = ((aLow * bLow) >> 32) + (lowHigh & 0xFFFFFFFF) + (highLow & 0xFFFFFFFF);
+    return aHigh * bHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+#    endif // __SIZEOF_INT128__
+}
+
+// The 128 bit multiplier of the PCG64 LCG, as its upper and lower 64 bits
+constexpr std::uint64_t pcgMultiplierHigh = 0x2360ED051FC65DA4;
+constexpr std::uint64_t pcgMultiplierLow = 0x4385DF649FCCF645;
 } // namespace internal
 
-template<LZ_CONCEPT_ARITHMETIC Arithmetic, class Distribution, class Generator>
-class Random final : public internal::BasicIteratorView<internal::RandomIterator<Arithmetic, Distribution, Generator>> {
+/**
+ * SplitMix64 by Sebastiano Vigna. A 64 bit state that is incremented by a constant for every number, which is then mixed. Very
+ * fast and passes BigCrush, but has a period of only 2^64. Mostly used to seed the other engines. Satisfies
+ * `UniformRandomBitGenerator`.
+ */
+class SplitMix64 {
+    std::uint64_t _state{};
+
+public:
+    using result_type = std::uint64_t;
+
+    constexpr explicit SplitMix64(const std::uint64_t seed = 0) noexcept : _state(seed) {
+    }
+
+    static constexpr result_type(min)() noexcept {
+        return 0;
+    }
+
+    static constexpr result_type(max)() noexcept {
+        return (std::numeric_limits<result_type>::max)();
+    }
+
+    LZ_CONSTEXPR_CXX_14 result_type operator()() noexcept {
+        std::uint64_t z = (_state += 0x9E3779B97F4A7C15);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+        return z ^ (z >> 31);
+    }
+
+    constexpr friend bool operator==(const SplitMix64& a, const SplitMix64& b) noexcept {
+        return a._state == b._state;
+    }
+
+    constexpr friend bool operator!=(const SplitMix64& a, const SplitMix64& b) noexcept {
+        return !(a == b); // NOLINT
+    }
+};
+
+/**
+ * xoshiro256** by David Blackman and Sebastiano Vigna. A 256 bit state with a period of 2^256 - 1, that only needs shifts,
+ * rotations and xors per number. The recommended general purpose 64 bit engine of its authors. Satisfies
+ * `UniformRandomBitGenerator`.
+ */
+class Xoshiro256StarStar {
+    std::array<std::uint64_t, 4> _state{};
+
+public:
+    using result_type = std::uint64_t;
+
+    // The state is filled with the output of `SplitMix64(seed)`, as recommended by the authors, so it can never be all zeros
+    explicit Xoshiro256StarStar(const std::uint64_t seed = 0) noexcept {
+        SplitMix64 seeds(seed);
+        for (std::uint64_t& word : _state) {
+            word = seeds();
+        }
+    }
+
+    // Uses `state` as is, which must not be all zeros
+    constexpr explicit Xoshiro256StarStar(const std::array<std::uint64_t, 4>& state) noexcept : _state(state) {
+    }
+
+    static constexpr result_type(min)() noexcept {
+        return 0;
+    }
+
+    static constexpr result_type(max)() noexcept {
+        return (std::numeric_limits<result_type>::max)();
+    }
+
+    result_type operator()() noexcept {
+        const std::uint64_t result = internal::rotateLeft(_state[1] * 5, 7) * 9;
+        const std::uint64_t t = _state[1] << 17;
+        _state[2] ^= _state[0];
+        _state[3] ^= _state[1];
+        _state[1] ^= _state[2];
+        _state[0] ^= _state[3];
+        _state[2] ^= t;
+        _state[3] = internal::rotateLeft(_state[3], 45);
+        return result;
+    }
+
+    friend bool operator==(const Xoshiro256StarStar& a, const Xoshiro256StarStar& b) noexcept {
+        return a._state == b._state;
+    }
+
+    friend bool operator!=(const Xoshiro256StarStar& a, const Xoshiro256StarStar& b) noexcept {
+        return !(a == b); // NOLINT
+    }
+};
+
+/**
+ * PCG64 (XSL RR 128/64) by Melissa O'Neill. A 128 bit LCG of which the output is permuted by a xorshift and a random rotation.
+ * It has a period of 2^128, and every `stream` gives a different sequence. Seeded the same way as `pcg64_srandom_r` of the PCG
+ * C library, so that `Pcg64(seed, stream)` gives the same numbers. Satisfies `UniformRandomBitGenerator`.
+ */
+class Pcg64 {
+    std::uint64_t _stateHigh{}, _stateLow{};
+    // Always odd
+    std::uint64_t _incrementHigh{}, _incrementLow{};
+
+    void step() noexcept {
+        const std::uint64_t low = _stateLow * internal::pcgMultiplierLow;
+        const std::uint64_t high = internal::multiplyHigh(_stateLow, internal::pcgMultiplierLow) +
+                                   _stateHigh * internal::pcgMultiplierLow + _stateLow * internal::pcgMultiplierHigh;
+        _stateLow = low + _incrementLow;
+        _stateHigh = high + _incrementHigh + static_cast<std::uint64_t>(_stateLow < low);
+    }
+
 public:
-    using iterator = internal::RandomIterator<Arithmetic, Distribution, Generator>;
+    using result_type = std::uint64_t;
+
+    explicit Pcg64(const std::uint64_t seed = 0xCAFEF00DD15EA5E5, const std::uint64_t stream = 0xDA3E39CB94B95BDB) noexcept :
+        _incrementHigh(stream >> 63),
+        _incrementLow((stream << 1) | 1) {
+        step();
+        _stateLow += seed;
+        _stateHigh += static_cast<std::uint64_t>(_stateLow < seed);
+        step();
+    }
+
+    static constexpr result_type(min)() noexcept {
+        return 0;
+    }
+
+    static constexpr result_type(max)() noexcept {
+        return (std::numeric_limits<result_type>::max)();
+    }
+
+    result_type operator()() noexcept {
+        step();
+        return internal::rotateRight(_stateHigh ^ _stateLow, static_cast<unsigned>(_stateHigh >> 58));
+    }
+
+    friend bool operator==(const Pcg64& a, const Pcg64& b) noexcept {
+        return a._stateHigh == b._stateHigh && a._stateLow == b._stateLow && a._incrementHigh == b._incrementHigh &&
+               a._incrementLow == b._incrementLow;
+    }
+
+    friend bool operator!=(const Pcg64& a, const Pcg64& b) noexcept {
+        return !(a == b); // NOLINT
+    }
+};
+
+template<LZ_CONCEPT_ARITHMETIC Arithmetic, class Distribution, class Generator, bool InlineGenerator = false>
+class Random final
+    : public internal::BasicIteratorView<internal::RandomIterator<Arithmetic, Distribution, Generator, InlineGenerator>> {
+public:
+    using iterator = internal::RandomIterator<Arithmetic, Distribution, Generator, InlineGenerator>;
     using const_iterator = iterator;
     using value_type = typename iterator::value_type;
 
@@ -144,7 +321,7 @@ public:
      * @return A new random `value_type` between [min, max].
      */
     LZ_NODISCARD value_type nextRandom() const {
-        return *this->begin();
+        return *this->_begin;
     }
 
     /**
@@ -262,6 +439,73 @@ random(const Floating min, const Floating max, const std::size_t amount = (std::
 
 #    endif // __cpp_if_constexpr
 
+namespace internal {
+template<class Arithmetic>
+using UniformDistribution = Conditional<std::is_integral<Arithmetic>::value, std::uniform_int_distribution<Arithmetic>,
+                                        std::uniform_real_distribution<Arithmetic>>;
+
+// Every engine is seeded by the next number of a `SplitMix64` per thread, of which only the seed comes from `std::random_device`
+inline std::uint64_t nextSeed() {
+    static thread_local SplitMix64 seeds([] {
+        std::random_device rd;
+        return (static_cast<std::uint64_t>(rd()) << 32) | static_cast<std::uint64_t>(rd());
+    }());
+    return seeds();
+}
+
+template<class Engine>
+Engine createEngine(std::false_type /* seedSequence */) {
+    return Engine(static_cast<typename Engine::result_type>(nextSeed()));
+}
+
+// A single seed would only determine one number of the state of large engines like `std::mt19937`, so those are seeded through a
+// seed sequence instead, like `createMtEngine`
+template<class Engine>
+Engine createEngine(std::true_type /* seedSequence */) {
+    std::random_device rd;
+    SeedSequence<8> seedSeq(rd);
+    return Engine(seedSeq);
+}
+
+template<class Engine>
+Engine& engineForView(std::false_type /* isSmallEngine */) {
+    static Engine engine = createEngine<Engine>(std::is_constructible<Engine, SeedSequence<8>&>());
+    return engine;
+}
+
+template<class Engine>
+Engine engineForView(std::true_type /* isSmallEngine */) {
+    return createEngine<Engine>(std::false_type());
+}
+} // namespace internal
+
+/**
+ * @brief Returns an iterator view object that generates a sequence of random numbers between [`min, max`], using a uniform
+ * distribution and the random engine `Engine`, for e.g. `lz::random<double, lz::Xoshiro256StarStar>(0., 1.)`.
+ * @details Engines of at most 64 bytes, like `lz::Xoshiro256StarStar`, `lz::Pcg64` and `lz::SplitMix64`, are seeded for every
+ * view and stored in its iterators, so no pointer to a shared engine has to be followed. Copies of those iterators generate the
+ * same numbers. Their seeds are the output of a `SplitMix64` per thread, that is seeded once by `std::random_device`. Larger
+ * engines, like `std::mt19937`, are shared by all views of the same engine and seeded once through a seed sequence of
+ * `std::random_device` numbers, if they can be constructed from one.
+ * @tparam Arithmetic The type of the random numbers.
+ * @tparam Engine The random engine, anything that satisfies `UniformRandomBitGenerator` and can be constructed from a seed.
+ * @param min The minimum value, included.
+ * @param max The maximum value, included.
+ * @param amount The amount of numbers to create. If left empty or equal to `std::numeric_limits<std::size_t>::max()`
+ * it is interpreted as a `while-true` loop.
+ * @return A random view object that generates a sequence of random numbers
+ */
+template<LZ_CONCEPT_ARITHMETIC Arithmetic, class Engine>
+LZ_NODISCARD Random<Arithmetic, internal::UniformDistribution<Arithmetic>, Engine, internal::IsSmallEngine<Engine>::value>
+random(const Arithmetic min, const Arithmetic max, const std::size_t amount = (std::numeric_limits<std::size_t>::max)()) {
+#    ifndef LZ_HAS_CONCEPTS
+    static_assert(std::is_arithmetic<Arithmetic>::value, "min/max type should be arithmetic");
+#    endif // LZ_HAS_CONCEPTS
+    auto&& engine = internal::engineForView<Engine>(internal::IsSmallEngine<Engine>());
+    return { internal::UniformDistribution<Arithmetic>(min, max), engine, static_cast<std::ptrdiff_t>(amount),
+             amount == (std::numeric_limits<std::size_t>::max)() };
+}
+
 // End of group
 /**
  * @}
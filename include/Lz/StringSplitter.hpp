@@ -4,9 +4,36 @@
 #define LZ_STRING_SPLITTER_HPP
 
 #include "detail/BasicIteratorView.hpp"
+#include "detail/IndexedSplitIterator.hpp"
+#include "detail/SplitAnyIterator.hpp"
 #include "detail/SplitIterator.hpp"
 
 namespace lz {
+template<class SubString>
+class IndexedSplit final : public internal::BasicIteratorView<internal::IndexedSplitIterator<SubString>> {
+public:
+    using const_iterator = internal::IndexedSplitIterator<SubString>;
+    using iterator = const_iterator;
+
+public:
+    using value_type = SubString;
+
+    IndexedSplit(const char* data, const std::shared_ptr<const internal::SplitIndex>& index) :
+        internal::BasicIteratorView<iterator>(iterator(data, index, 0), iterator(data, index, index->size())) {
+    }
+
+    IndexedSplit() = default;
+
+    /**
+     * Returns token `index` in O(1).
+     * @param index The index of the token, must be smaller than `size()`.
+     * @return The token at `index`.
+     */
+    LZ_NODISCARD SubString operator[](const std::size_t index) const {
+        return this->begin()[static_cast<std::ptrdiff_t>(index)];
+    }
+};
+
 template<class SubString, class String, class StringType>
 class StringSplitter final : public internal::BasicIteratorView<internal::SplitIterator<SubString, String, StringType>> {
 public:
@@ -21,6 +48,61 @@ public:
     }
 
     StringSplitter() = default;
+
+#ifdef LZ_HAS_EXECUTION
+    /**
+     * @brief Finds all delimiters up front and returns a random access view over the tokens, so that the tokens can be accessed
+     * in O(1) by index and materialized in parallel. The string is scanned in blocks using `execution`, after which the delimiter
+     * positions of the blocks are merged into one index that stores a single offset per token.
+     * @param execution The execution policy or `lz::ThreadPoolExecutor` to scan the blocks with.
+     * @return A random access view over the same tokens as this splitter. The string must outlive it.
+     * @throws `std::invalid_argument` if the delimiter is empty.
+     */
+    template<class Execution = std::execution::sequenced_policy>
+    LZ_NODISCARD IndexedSplit<SubString> indexed(Execution execution = std::execution::seq) const {
+        static_cast<void>(internal::checkForwardAndPolicies<Execution, iterator>());
+        const iterator begin = this->begin();
+        const String& string = begin.string();
+        if constexpr (internal::IsSequencedPolicyV<Execution>) {
+            return { string.data(), std::make_shared<const internal::SplitIndex>(string.data(), string.size(), begin.delimiter(),
+                                                                                   begin.delimiterLength()) };
+        }
+        else {
+            return { string.data(), std::make_shared<const internal::SplitIndex>(execution, string.data(), string.size(),
+                                                                                   begin.delimiter(), begin.delimiterLength()) };
+        }
+    }
+#else
+    /**
+     * @brief Finds all delimiters up front and returns a random access view over the tokens, so that the tokens can be accessed
+     * in O(1) by index. The index stores a single offset per token.
+     * @return A random access view over the same tokens as this splitter. The string must outlive it.
+     * @throws `std::invalid_argument` if the delimiter is empty.
+     */
+    LZ_NODISCARD IndexedSplit<SubString> indexed() const {
+        const iterator begin = this->begin();
+        const String& string = begin.string();
+        return { string.data(), std::make_shared<const internal::SplitIndex>(string.data(), string.size(), begin.delimiter(),
+                                                                               begin.delimiterLength()) };
+    }
+#endif // LZ_HAS_EXECUTION
+};
+
+template<class SubString, class String>
+class SplitAny final : public internal::BasicIteratorView<internal::SplitAnyIterator<SubString, String>> {
+public:
+    using const_iterator = internal::SplitAnyIterator<SubString, String>;
+    using iterator = const_iterator;
+
+public:
+    using value_type = SubString;
+
+    SplitAny(const String& str, const internal::CharSet& delimiters, const bool collapse) :
+        internal::BasicIteratorView<iterator>(iterator(0, str, delimiters, collapse),
+                                              iterator(str.size(), str, delimiters, collapse)) {
+    }
+
+    SplitAny() = default;
 };
 
 // Start of group
@@ -90,6 +172,68 @@ template<class SubString = fmt::string_view>
 #endif
 StringSplitter<SubString, std::string, std::string> split(std::string&& str, std::string delimiter) = delete;
 
+#if defined(LZ_HAS_STRING_VIEW)
+template<class SubString = std::string_view>
+#elif defined(LZ_STANDALONE)
+template<class SubString = std::string>
+#else
+template<class SubString = fmt::string_view>
+#endif
+/**
+ * @brief Splits a string on every character that is in `delimiters`. The characters of the string are classified 64 at a time
+ * using a bitmap of `delimiters` (and SIMD instructions for up to 8 delimiters), instead of calling `find_first_of` per substring.
+ * @tparam SubString The string type of the substring. If C++17, this will default to `std::string_view`. If `LZ_STANDALONE` is
+ * not defined and C++17 is not defined, this will default to `std::string`. Otherwise it will default to `fmt::string_view`.
+ * Furthermore, `SubString` should have a constructor which looks like `SubString([const]char*, std::size_t length)`:
+ * @param str The string to split.
+ * @param delimiters The characters to split on, for e.g. `",;|"`.
+ * @param collapse If true, consecutive delimiters are treated as one delimiter, and no empty substrings are returned.
+ * @return A SplitAny object that can be converted to an arbitrary container or can be iterated over using
+ * `for (auto... lz::splitAny(...))`.
+ */
+LZ_NODISCARD SplitAny<SubString, std::string>
+splitAny(const std::string& str, const std::string& delimiters, const bool collapse = false) {
+    return { str, internal::CharSet(delimiters.data(), delimiters.size()), collapse };
+}
+
+#if defined(LZ_HAS_STRING_VIEW)
+template<class SubString = std::string_view>
+#elif defined(LZ_STANDALONE)
+template<class SubString = std::string>
+#else
+template<class SubString = fmt::string_view>
+#endif
+SplitAny<SubString, std::string> splitAny(std::string&& str, const std::string& delimiters, bool collapse = false) = delete;
+
+#if defined(LZ_HAS_STRING_VIEW)
+template<class SubString = std::string_view>
+#elif defined(LZ_STANDALONE)
+template<class SubString = std::string>
+#else
+template<class SubString = fmt::string_view>
+#endif
+/**
+ * @brief Splits a string on whitespace (`' '`, `'\t'`, `'\n'`, `'\v'`, `'\f'` and `'\r'`). See `splitAny` for details.
+ * @tparam SubString The string type of the substring. If C++17, this will default to `std::string_view`. If `LZ_STANDALONE` is
+ * not defined and C++17 is not defined, this will default to `std::string`. Otherwise it will default to `fmt::string_view`.
+ * @param str The string to split.
+ * @param collapse If true (default), consecutive whitespace is treated as one delimiter, and no empty substrings are returned.
+ * @return A SplitAny object that can be converted to an arbitrary container or can be iterated over using
+ * `for (auto... lz::splitWhitespace(...))`.
+ */
+LZ_NODISCARD SplitAny<SubString, std::string> splitWhitespace(const std::string& str, const bool collapse = true) {
+    return splitAny<SubString>(str, " \t\n\v\f\r", collapse);
+}
+
+#if defined(LZ_HAS_STRING_VIEW)
+template<class SubString = std::string_view>
+#elif defined(LZ_STANDALONE)
+template<class SubString = std::string>
+#else
+template<class SubString = fmt::string_view>
+#endif
+SplitAny<SubString, std::string> splitWhitespace(std::string&& str, bool collapse = true) = delete;
+
 #ifdef LZ_HAS_STRING_VIEW
 /**
  * @brief This is a lazy evaluated string splitter function. It splits a string using `delimiter`.
@@ -116,6 +260,41 @@ StringSplitter<SubString, std::string_view, std::string> split(std::string_view&
 
 template<class SubString = std::string_view>
 StringSplitter<SubString, std::string_view, std::string> split(std::string_view&& str, std::string delimiter) = delete;
+
+/**
+ * @brief Splits a string on every character that is in `delimiters`. The characters of the string are classified 64 at a time
+ * using a bitmap of `delimiters` (and SIMD instructions for up to 8 delimiters), instead of calling `find_first_of` per substring.
+ * @tparam SubString The string type of the substring.
+ * @param str The string to split.
+ * @param delimiters The characters to split on, for e.g. `",;|"`.
+ * @param collapse If true, consecutive delimiters are treated as one delimiter, and no empty substrings are returned.
+ * @return A SplitAny object that can be converted to an arbitrary container or can be iterated over using
+ * `for (auto... lz::splitAny(...))`.
+ */
+template<class SubString = std::string_view>
+LZ_NODISCARD SplitAny<SubString, std::string_view>
+splitAny(const std::string_view& str, const std::string_view delimiters, const bool collapse = false) {
+    return { str, internal::CharSet(delimiters.data(), delimiters.size()), collapse };
+}
+
+template<class SubString = std::string_view>
+SplitAny<SubString, std::string_view> splitAny(std::string_view&& str, std::string_view delimiters, bool collapse = false) = delete;
+
+/**
+ * @brief Splits a string on whitespace (`' '`, `'\t'`, `'\n'`, `'\v'`, `'\f'` and `'\r'`). See `splitAny` for details.
+ * @tparam SubString The string type of the substring.
+ * @param str The string to split.
+ * @param collapse If true (default), consecutive whitespace is treated as one delimiter, and no empty substrings are returned.
+ * @return A SplitAny object that can be converted to an arbitrary container or can be iterated over using
+ * `for (auto... lz::splitWhitespace(...))`.
+ */
+template<class SubString = std::string_view>
+LZ_NODISCARD SplitAny<SubString, std::string_view> splitWhitespace(const std::string_view& str, const bool collapse = true) {
+    return splitAny<SubString>(str, " \t\n\v\f\r", collapse);
+}
+
+template<class SubString = std::string_view>
+SplitAny<SubString, std::string_view> splitWhitespace(std::string_view&& str, bool collapse = true) = delete;
 #endif // LZ_HAS_STRING_VIEW
 
 // End of group
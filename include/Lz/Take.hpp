@@ -62,7 +62,7 @@ LZ_NODISCARD LZ_CONSTEXPR_CXX_20 internal::BasicIteratorView<Iterator>
 dropRange(Iterator begin, Iterator end, const internal::DiffType<Iterator> amount) {
     using lz::next;
     using std::next;
-    return takeRange(next(begin, amount), end, internal::getIterLength(begin, end) - amount);
+    return { next(std::move(begin), amount), std::move(end) };
 }
 
 /**
@@ -121,7 +121,7 @@ takeWhileRange(Iterator begin, Iterator end, Function predicate, Execution execu
         end = std::find_if_not(begin, end, predicate);
     }
     else {
-        end = std::find_if_not(execution, begin, end, predicate);
+        end = internal::findIfNot(execution, begin, end, predicate);
     }
     return { std::move(begin), std::move(end) };
 }
@@ -162,7 +162,7 @@ dropWhileRange(Iterator begin, Iterator end, Function predicate, Execution execu
         begin = std::find_if_not(std::move(begin), end, std::move(predicate));
     }
     else {
-        begin = std::find_if_not(execution, std::move(begin), end, std::move(predicate));
+        begin = internal::findIfNot(execution, std::move(begin), end, std::move(predicate));
     }
     return takeRange(begin, end, internal::getIterLength(begin, end));
 }
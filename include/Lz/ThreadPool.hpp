@@ -0,0 +1,8 @@
+#pragma once
+
+#ifndef LZ_THREAD_POOL_PUBLIC_HPP
+#define LZ_THREAD_POOL_PUBLIC_HPP
+
+#include "detail/ThreadPool.hpp"
+
+#endif // LZ_THREAD_POOL_PUBLIC_HPP
@@ -18,98 +18,193 @@
 #            include <sstream>
 #        endif // LZ_HAS_FORMAT
 #    else
+#        include <fmt/compile.h>
 #        include <fmt/ostream.h>
 #    endif // LZ_STANDALONE
 
 #    include "LzTools.hpp"
+#    include "OutputSink.hpp"
+#    include "ParallelAlgorithms.hpp"
+#    include "ToChars.hpp"
 
 namespace lz {
 namespace internal {
+// The elements are converted to a string as their value type, unless the reference cannot be implicitly converted to it (like a
+// `std::string_view` to a `std::string`)
+template<class Iterator>
+using StringElement = Conditional<std::is_convertible<RefType<Iterator>, ValueType<Iterator>>::value, const ValueType<Iterator>&,
+                                  RefType<Iterator>>;
+
 #    if defined(LZ_STANDALONE) && !defined(LZ_HAS_FORMAT)
-#        ifdef __cpp_if_constexpr
-template<class T>
-std::string makeStringFormattedFP(const T value) {
-    if constexpr (std::is_floating_point_v<T>) {
-        auto str = std::to_string(value);
-        str.erase(str.find_last_not_of('0') + 1, std::string::npos);
-        return str;
-    }
-    else {
-        using lz::internal::to_string;
-        using std::to_string;
-        return to_string(value);
-    }
-}
-#        else
-template<class T>
-EnableIf<std::is_floating_point<T>::value, std::string> makeStringFormattedFP(const T value) {
-    auto str = std::to_string(value);
-    str.erase(str.find_last_not_of('0') + 1, std::string::npos);
-    return str;
+template<class Iterator>
+void reserveChars(std::string&, const Iterator&, const Iterator&, std::size_t, std::false_type /* isArithmetic */) {
 }
 
-template<class T>
-EnableIf<!std::is_floating_point<T>::value, std::string> makeStringFormattedFP(const T value) {
-    using lz::internal::to_string;
-    using std::to_string;
-    return to_string(value);
+// Arithmetic values take at most `maxChars` characters, so the result can be presized to the length of the sequence
+template<class Iterator>
+void reserveChars(std::string& result, const Iterator& begin, const Iterator& end, const std::size_t delimiterLength,
+                  std::true_type /* isArithmetic */) {
+    result.reserve(result.size() + getSizeHint(begin, end).lower * (maxChars<ValueType<Iterator>>() + delimiterLength));
 }
-#        endif // __cpp_if_constexpr
 
 template<class Iterator>
-EnableIf<std::is_arithmetic<ValueType<Iterator>>::value>
+EnableIf<IsAppendable<ValueType<Iterator>>::value>
 toStringImplSpecialized(std::string& result, Iterator begin, Iterator end, const StringView& delimiter) {
-    std::for_each(begin, end, [&delimiter, &result](const ValueType<Iterator>& vt) {
-        using std::to_string;
-        using lz::internal::to_string;
-        result += makeStringFormattedFP(vt);
+    reserveChars(result, begin, end, delimiter.size(), std::is_arithmetic<ValueType<Iterator>>());
+    std::for_each(begin, end, [&delimiter, &result](StringElement<Iterator> value) {
+        appendValue(result, value);
         result += delimiter;
     });
 }
 
 template<class Iterator>
-EnableIf<!std::is_arithmetic<ValueType<Iterator>>::value>
+EnableIf<!IsAppendable<ValueType<Iterator>>::value>
 toStringImplSpecialized(std::string & result, Iterator begin, Iterator end, const StringView& delimiter) {
     std::ostringstream oss;
-    std::for_each(begin, end, [&oss, &delimiter](const ValueType<Iterator>& t) { oss << t << delimiter; });
+    std::for_each(begin, end, [&oss, &delimiter](StringElement<Iterator> t) { oss << t << delimiter; });
     result = oss.str();
 }
 #    endif // defined(LZ_STANDALONE) && !defined(LZ_HAS_FORMAT)
 
-template<class Iterator>
-LZ_CONSTEXPR_CXX_20 void
+#    if !defined(LZ_STANDALONE)
+// True for format strings made with `FMT_COMPILE`, which can only be converted explicitly to `fmt::string_view`. Before C++17,
+// `FMT_COMPILE` falls back to `FMT_STRING`, which converts implicitly and is taken as a regular format string. Only uses the
+// public API of {fmt}, because the traits in `fmt::detail` differ between its versions
+template<class S>
+using IsCompiledFormat = std::integral_constant<bool, std::is_constructible<fmt::string_view, const S&>::value &&
+                                                          !std::is_convertible<const S&, fmt::string_view>::value>;
+
+template<class CompiledFormat>
+struct CompiledFormatFn {
+    CompiledFormat format;
+
+    template<class Out, class T>
+    void operator()(Out& out, const T& value) const {
+        fmt::format_to(std::back_inserter(out), format, value);
+    }
+};
+
+// `"{}"` is parsed at compile time
+struct DefaultFormatFn {
+    template<class Out, class T>
+    void operator()(Out& out, const T& value) const {
+        fmt::format_to(std::back_inserter(out), FMT_COMPILE("{}"), value);
+    }
+};
+
+// Any other format string is parsed for every value
+struct RuntimeFormatFn {
+    StringView format;
+
+    template<class Out, class T>
+    void operator()(Out& out, const T& value) const {
+        fmt::vformat_to(std::back_inserter(out), fmt::string_view(format.data(), format.size()), fmt::make_format_args(value));
+    }
+};
+#    elif defined(LZ_HAS_FORMAT)
+struct DefaultFormatFn {
+    template<class T>
+    void operator()(std::string& out, const T& value) const {
+        std::format_to(std::back_inserter(out), "{}", value);
+    }
+};
+
+struct RuntimeFormatFn {
+    StringView format;
+
+    template<class T>
+    void operator()(std::string& out, const T& value) const {
+        std::vformat_to(std::back_inserter(out), format, std::make_format_args(value));
+    }
+};
+#    else
+struct DefaultFormatFn {
+    template<class T>
+    void operator()(std::string& out, const T& value) const {
+        appendValue(out, value);
+    }
+};
+#    endif // LZ_STANDALONE
+
+// Formats the elements into a buffer of about `bufferSize` characters, that is written to `sink` every time it is full. The
+// delimiter is written before every element but the first, because the characters that have been written cannot be removed
+template<class Sink, class Iterator, class FormatFn>
+void writeFormatted(Sink& sink, const Iterator& begin, const Iterator& end, const StringView delimiter, const FormatFn& formatFn,
+                    const std::size_t bufferSize) {
+    // Not reserved up front, a short view should not allocate `bufferSize` characters
+    std::string buffer;
+    bool first = true;
+    std::for_each(begin, end, [&](StringElement<Iterator> v) {
+        if (!first) {
+            buffer.append(delimiter.data(), delimiter.size());
+        }
+        first = false;
+        formatFn(buffer, v);
+        if (buffer.size() >= bufferSize) {
+            sink.write(buffer.data(), buffer.size());
+            buffer.clear();
+        }
+    });
+    if (!buffer.empty()) {
+        sink.write(buffer.data(), buffer.size());
+    }
+}
+
+// The buffer size of `formatTo`, large enough to write to the output iterator in bulk
+constexpr std::size_t formatToBufferSize = 4096;
+
 #    if defined(LZ_HAS_FORMAT) || !defined(LZ_STANDALONE)
-toStringImpl(std::string& result, const Iterator& begin, const Iterator& end, const StringView delimiter, const StringView fmt) {
+inline bool isDefaultFormat(const StringView fmt) noexcept {
+    return fmt.size() == 2 && fmt[0] == '{' && fmt[1] == '}';
+}
+
+template<class Out, class Iterator, class FormatFn>
+LZ_CONSTEXPR_CXX_20 void
+toStringFormatted(Out& result, const Iterator& begin, const Iterator& end, const StringView delimiter, const FormatFn& formatFn) {
+    if (begin == end) {
+        return;
+    }
+    // The delimiter is appended as is, instead of being part of the format
+    std::for_each(begin, end, [&result, &delimiter, &formatFn](StringElement<Iterator> v) {
+        formatFn(result, v);
+        result.append(delimiter.data(), delimiter.data() + delimiter.size());
+    });
+    result.resize(result.size() - delimiter.size());
+}
+
+template<class Out, class Iterator>
+LZ_CONSTEXPR_CXX_20 void
+toStringImpl(Out& result, const Iterator& begin, const Iterator& end, const StringView delimiter, const StringView fmt) {
+    if (isDefaultFormat(fmt)) {
+        toStringFormatted(result, begin, end, delimiter, DefaultFormatFn());
+    }
+    else {
+        toStringFormatted(result, begin, end, delimiter, RuntimeFormatFn{ fmt });
+    }
+}
+
+template<class Sink, class Iterator>
+void writeFormatted(Sink& sink, const Iterator& begin, const Iterator& end, const StringView delimiter, const StringView fmt,
+                    const std::size_t bufferSize) {
+    if (isDefaultFormat(fmt)) {
+        writeFormatted(sink, begin, end, delimiter, DefaultFormatFn(), bufferSize);
+    }
+    else {
+        writeFormatted(sink, begin, end, delimiter, RuntimeFormatFn{ fmt }, bufferSize);
+    }
+}
 #    else
+template<class Iterator>
+LZ_CONSTEXPR_CXX_20 void
 toStringImpl(std::string& result, const Iterator& begin, const Iterator& end, const StringView& delimiter) {
-#    endif // LZ_HAS_FORMAT
     if (begin == end) {
         return;
     }
-#    if !defined(LZ_STANDALONE) || defined(LZ_HAS_FORMAT)
-    auto backInserter = std::back_inserter(result);
-    // Dynamic format merge with the `fmt` and the "{}" for the delimiter
-    std::string format;
-    format.reserve(3 + fmt.size());
-    format.append(fmt.data(), fmt.size());
-    format += "{}";
-#    endif // !defined(LZ_STANDALONE) || defined(LZ_HAS_FORMAT)
-#    if !defined(LZ_STANDALONE)
-    std::for_each(begin, end, [&delimiter, backInserter, &format](const ValueType<Iterator>& v) {
-        fmt::format_to(backInserter, format.c_str(), v, delimiter);
-    });
-#    elif defined(LZ_HAS_FORMAT)
-    std::for_each(begin, end, [&delimiter, backInserter, &format](const ValueType<Iterator>& v) {
-        std::format_to(backInserter, format.c_str(), v, delimiter);
-    });
-    // clang-format off
-#else
     toStringImplSpecialized(result, begin, end, delimiter);
-#endif // LZ_STANDALONE
-    // clang-format on
     const auto resultEnd = result.end();
     result.erase(resultEnd - static_cast<std::ptrdiff_t>(delimiter.size()), resultEnd);
 }
+#    endif // LZ_HAS_FORMAT
 
 template<class Iterator>
 LZ_CONSTEXPR_CXX_20 internal::EnableIf<std::is_same<char, ValueType<Iterator>>::value, std::string>
@@ -123,8 +218,11 @@ doMakeString(const Iterator& b, const Iterator& e, const StringView& delimiter)
     }
     std::string result;
 
-    const auto len = static_cast<std::size_t>(getIterLength(b, e));
-    result.reserve(len + delimiter.size() * len + 1);
+    // Input iterators can only be traversed once, so the length cannot be computed up front
+    if (IsForward<Iterator>::value) {
+        const auto len = static_cast<std::size_t>(getIterLength(b, e));
+        result.reserve(len + delimiter.size() * len + 1);
+    }
 
 #    if defined(LZ_HAS_FORMAT) || !defined(LZ_STANDALONE)
     toStringImpl(result, b, e, delimiter, fmt);
@@ -150,6 +248,56 @@ doMakeString(const Iterator& b, const Iterator& e, const StringView& delimiter)
     return result;
 }
 
+#    ifdef LZ_HAS_EXECUTION
+/**
+ * Converts a random access sequence to a string in parallel. Every block of elements is formatted on its own thread into its own
+ * buffer. The prefix sum of the buffer sizes gives the offset of every block in the result, so that the buffers can be copied in
+ * parallel into a string that is allocated once, with its exact size.
+ */
+template<class Execution, class Iterator, class FormatFn>
+std::string parallelToString(Execution execution, const Iterator& begin, const Iterator& end, const StringView delimiter,
+                             const FormatFn& formatFn) {
+    using Diff = DiffType<Iterator>;
+    const auto length = static_cast<std::size_t>(end - begin);
+    if (length == 0) {
+        return {};
+    }
+    const std::size_t blocks = blockCount(threadCount(execution), length, 2048, 8);
+    std::vector<std::string> buffers(blocks);
+    std::vector<std::size_t> offsets(blocks + 1);
+    parallelForEachBlock(execution, length, blocks,
+                         [&](const std::size_t block, const std::size_t first, const std::size_t last) {
+                             std::string& buffer = buffers[block];
+                             for (std::size_t i = first; i < last; ++i) {
+                                 formatFn(buffer, static_cast<StringElement<Iterator>>(begin[static_cast<Diff>(i)]));
+                                 buffer.append(delimiter.data(), delimiter.size());
+                             }
+                             offsets[block + 1] = buffer.size();
+                         });
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    // The delimiter after the last element is not copied
+    const std::size_t size = offsets.back() - delimiter.size();
+    std::string result(size, '\0');
+    parallelForEachBlock(execution, blocks, blocks, [&](const std::size_t block, std::size_t, std::size_t) {
+        const std::size_t count = (std::min)(buffers[block].size(), size - offsets[block]);
+        std::copy_n(buffers[block].data(), count, result.data() + offsets[block]);
+    });
+    return result;
+}
+
+#        if defined(LZ_HAS_FORMAT) || !defined(LZ_STANDALONE)
+template<class Execution, class Iterator>
+std::string parallelToString(Execution execution, const Iterator& begin, const Iterator& end, const StringView delimiter,
+                             const StringView fmt) {
+    if (isDefaultFormat(fmt)) {
+        return parallelToString(execution, begin, end, delimiter, DefaultFormatFn());
+    }
+    return parallelToString(execution, begin, end, delimiter, RuntimeFormatFn{ fmt });
+}
+#        endif // LZ_HAS_FORMAT
+#    endif // LZ_HAS_EXECUTION
+
 template<class T, class = int>
 struct HasResize : std::false_type {};
 
@@ -179,23 +327,156 @@ private:
     template<class KeySelectorFunc>
     using KeyType = FunctionReturnType<KeySelectorFunc, RefType<LzIterator>>;
 
+    // Only reserve if the size can be computed without iterating, otherwise the sequence would be evaluated twice
 #    ifndef __cpp_if_constexpr
     template<class Container>
-    EnableIf<!HasReserve<Container>::value> tryReserve(Container&) const {
+    EnableIf<!HasReserve<Container>::value || !IsSized<LzIterator>::value> tryReserve(Container&) const {
     }
 
     template<class Container>
-    EnableIf<HasReserve<Container>::value> tryReserve(Container& container) const {
+    EnableIf<HasReserve<Container>::value && IsSized<LzIterator>::value> tryReserve(Container& container) const {
         container.reserve(size());
     }
 #    else
     template<class Container>
     LZ_CONSTEXPR_CXX_20 void tryReserve(Container& container) const {
-        if constexpr (HasReserve<Container>::value) {
+        if constexpr (HasReserve<Container>::value && IsSized<LzIterator>::value) {
             container.reserve(size());
         }
     }
 #    endif // __cpp_if_constexpr
+
+    template<class Container>
+    void collectInto(Container& container, std::false_type /* collectSegmented */) const {
+        tryReserve(container);
+        copyTo(std::inserter(container, container.begin()));
+    }
+
+    // The length is unknown, so the elements are gathered in a single pass into geometrically growing segments, after which
+    // `container` is allocated once. This prevents evaluating the sequence twice (once for the size) or reallocating
+    // `container` repeatedly
+    template<class Container>
+    void collectInto(Container& container, std::true_type /* collectSegmented */) const {
+        using Segment = std::vector<value_type>;
+        const std::size_t minSegmentSize = 64;
+        const std::size_t lower = getSizeHint(_begin, _end).lower;
+
+        std::vector<Segment> segments(1);
+        segments.back().reserve(lower > minSegmentSize ? lower : minSegmentSize);
+        std::size_t total = 0;
+        forEachUntil(_begin, _end, [&segments, &total](reference value) {
+            if (segments.back().size() == segments.back().capacity()) {
+                const std::size_t capacity = segments.back().capacity() * 2;
+                segments.emplace_back();
+                segments.back().reserve(capacity);
+            }
+            emplaceValue(segments.back(), std::forward<reference>(value), std::is_constructible<value_type, reference>());
+            ++total;
+            return false;
+        });
+
+        container.reserve(container.size() + total);
+        auto inserter = std::inserter(container, container.begin());
+        for (Segment& segment : segments) {
+            inserter = std::move(segment.begin(), segment.end(), inserter);
+        }
+    }
+
+#    ifdef LZ_HAS_EXECUTION
+    // Collects the matches of a parallel compaction (e.g. a filter with a parallel policy) into `container`, using the policy of
+    // the view, or `execution` if it is given
+    template<class Container, class... Execution>
+    void compactInto(Container& container, const Execution... execution) const {
+        auto compaction = compact(_begin, _end, execution...);
+        if constexpr (HasResize<Container>::value && IsRandomAccess<typename Container::iterator>::value) {
+            if (container.empty()) {
+                container.resize(compaction.size());
+                scatter(_begin, compaction, container.begin());
+                return;
+            }
+        }
+        if constexpr (std::is_default_constructible<value_type>::value) {
+            std::vector<value_type> matches(compaction.size());
+            scatter(_begin, compaction, matches.begin());
+            if constexpr (HasReserve<Container>::value) {
+                container.reserve(container.size() + matches.size());
+            }
+            std::move(matches.begin(), matches.end(), std::inserter(container, container.begin()));
+        }
+        else {
+            collectInto(container, std::integral_constant<bool, HasReserve<Container>::value>());
+        }
+    }
+
+    template<class Container>
+    void collectInto(Container& container) const {
+        if constexpr (IsCompactable<LzIterator>::value) {
+            compactInto(container);
+        }
+        else {
+            collectInto(container, std::integral_constant<bool, HasReserve<Container>::value && !IsSized<LzIterator>::value>());
+        }
+    }
+#    else
+    template<class Container>
+    void collectInto(Container& container) const {
+        collectInto(container, std::integral_constant<bool, HasReserve<Container>::value && !IsSized<LzIterator>::value>());
+    }
+#    endif // LZ_HAS_EXECUTION
+
+#    ifdef LZ_HAS_EXECUTION
+    // Every block is evaluated in parallel into its own buffer, after which the buffers are moved into `container` in order, so
+    // that no element has to be default constructed first
+    template<class Container, class Execution>
+    void collectBlocks(Container& container, Execution execution) const {
+        using Diff = DiffType<LzIterator>;
+        const std::size_t length = size();
+        const std::size_t blocks = blockCount(threadCount(execution), length, cacheBlockSize<value_type>());
+        std::vector<std::vector<value_type>> buffers(blocks);
+        parallelForEachBlock(execution, length, blocks,
+                             [this, &buffers](const std::size_t block, const std::size_t first, const std::size_t last) {
+                                 std::vector<value_type>& buffer = buffers[block];
+                                 buffer.reserve(last - first);
+                                 for (auto it = _begin + static_cast<Diff>(first); it != _begin + static_cast<Diff>(last); ++it) {
+                                     emplaceValue(buffer, *it, std::is_constructible<value_type, reference>());
+                                 }
+                             });
+
+        tryReserve(container);
+        auto inserter = std::inserter(container, container.begin());
+        for (std::vector<value_type>& buffer : buffers) {
+            inserter = std::move(buffer.begin(), buffer.end(), inserter);
+        }
+    }
+
+    // Random access sequences are split into blocks that are evaluated in parallel. Trivial types are written directly into their
+    // place in the resized container, other types are collected block-wise. Sequences that are not random access are collected
+    // sequentially, because computing their size would evaluate them twice
+    template<class Container, class Execution>
+    void parallelCollectInto(Container& container, Execution execution) const {
+        if constexpr (IsCompactable<LzIterator>::value) {
+            compactInto(container, execution);
+        }
+        else if constexpr (IsRandomAccess<LzIterator>::value && IsSized<LzIterator>::value) {
+            if constexpr (HasResize<Container>::value && std::is_trivially_default_constructible<value_type>::value &&
+                          IsRandomAccess<typename Container::iterator>::value) {
+                if (container.empty()) {
+                    container.resize(size());
+                    copyTo(container.begin(), execution);
+                    return;
+                }
+            }
+            collectBlocks(container, execution);
+        }
+        else {
+            static_assert(IsForward<LzIterator>::value,
+                          "The iterator type must be forward iterator or stronger. Prefer using std::execution::seq");
+            static_cast<void>(execution);
+            collectInto(container);
+        }
+    }
+#    endif // LZ_HAS_EXECUTION
+
     template<class MapType, class KeySelectorFunc>
     LZ_CONSTEXPR_CXX_20 void createMap(MapType& map, const KeySelectorFunc keyGen) const {
         transformTo(std::inserter(map, map.end()),
@@ -273,16 +554,12 @@ public:
     template<class Container, class... Args, class Execution = std::execution::sequenced_policy>
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Container to(Execution execution = std::execution::seq, Args&&... args) const {
         Container container(std::forward<Args>(args)...);
-        tryReserve(container);
         if constexpr (internal::IsSequencedPolicyV<Execution>) {
-            tryReserve(container);
-            copyTo(std::inserter(container, container.begin()), execution);
+            static_cast<void>(execution);
+            collectInto(container);
         }
         else {
-            static_assert(HasResize<Container>::value, "Container needs to have a method resize() in order to use parallel "
-                                                       " algorithms. Use std::execution::seq instead");
-            container.resize(size());
-            copyTo(container.begin(), execution);
+            parallelCollectInto(container, execution);
         }
         return container;
     }
@@ -295,13 +572,18 @@ public:
      */
     template<class OutputIterator, class Execution = std::execution::sequenced_policy>
     LZ_CONSTEXPR_CXX_20 void copyTo(OutputIterator outputIterator, Execution execution = std::execution::seq) const {
-        if constexpr (internal::checkForwardAndPolicies<Execution, OutputIterator>()) {
-            std::copy(_begin, _end, outputIterator);
+        if constexpr (IsCompactable<LzIterator>::value && !internal::IsSequencedPolicyV<Execution> &&
+                      IsRandomAccess<OutputIterator>::value) {
+            auto compaction = compact(_begin, _end, execution);
+            scatter(_begin, compaction, outputIterator);
+        }
+        else if constexpr (internal::checkForwardAndPolicies<Execution, OutputIterator>()) {
+            internal::copy(_begin, _end, outputIterator);
         }
         else {
             static_assert(IsForward<LzIterator>::value,
                           "The iterator type must be forward iterator or stronger. Prefer using std::execution::seq");
-            std::copy(execution, _begin, _end, outputIterator);
+            internal::copy(execution, _begin, _end, outputIterator);
         }
     }
 
@@ -316,13 +598,13 @@ public:
     LZ_CONSTEXPR_CXX_20 void
     transformTo(OutputIterator outputIterator, TransformFunc transformFunc, Execution execution = std::execution::seq) const {
         if constexpr (internal::IsSequencedPolicyV<Execution>) {
-            std::transform(_begin, _end, outputIterator, transformFunc);
+            internal::transform(_begin, _end, outputIterator, transformFunc);
         }
         else {
             static_assert(IsForward<LzIterator>::value, "Iterator type must be at least forward to use parallel execution");
             static_assert(IsForward<OutputIterator>::value,
                           "Output iterator type must be at least forward to use parallel execution");
-            std::transform(execution, _begin, _end, outputIterator, transformFunc);
+            internal::transform(execution, _begin, _end, outputIterator, transformFunc);
         }
     }
 
@@ -402,8 +684,7 @@ public:
     template<class Container, class... Args>
     Container to(Args&&... args) const {
         Container cont(std::forward<Args>(args)...);
-        tryReserve(cont);
-        copyTo(std::inserter(cont, cont.begin()));
+        collectInto(cont);
         return cont;
     }
 
@@ -414,7 +695,7 @@ public:
      */
     template<class OutputIterator>
     void copyTo(OutputIterator outputIterator) const {
-        std::copy(_begin, _end, outputIterator);
+        internal::copy(_begin, _end, outputIterator);
     }
 
     /**
@@ -425,7 +706,7 @@ public:
      */
     template<class OutputIterator, class TransformFunc>
     void transformTo(OutputIterator outputIterator, TransformFunc transformFunc) const {
-        std::transform(_begin, _end, outputIterator, transformFunc);
+        internal::transform(_begin, _end, outputIterator, transformFunc);
     }
 
     /**
@@ -503,7 +784,7 @@ public:
     toUnorderedMap(const KeySelectorFunc keyGen, const Allocator& alloc = {}, const KeyEquality& cmp = {},
                    const Hasher& h = {}) const {
         using UnorderedMap = std::unordered_map<KeyType<KeySelectorFunc>, value_type, Hasher, KeyEquality, Allocator>;
-        UnorderedMap um(static_cast<std::size_t>(internal::getIterLength(_begin, _end)), h, cmp, alloc);
+        UnorderedMap um(IsSized<LzIterator>::value ? size() : 0, h, cmp, alloc);
         createMap(um, keyGen);
         return um;
     }
@@ -526,6 +807,119 @@ public:
         // clang-format off
     }
 
+#    if !defined(LZ_STANDALONE)
+    /**
+     * Converts an iterator to a string, with a given delimiter and a format string that is compiled using `FMT_COMPILE`.
+     * Unlike `toString(delimiter, fmt)`, the format string is parsed at compile time instead of for every value. Example:
+     * `lz::range(4).toString(", ", FMT_COMPILE("{:02}"))` yields 00, 01, 02, 03.
+     * @param delimiter The delimiter between the previous value and the next.
+     * @param fmt The compiled format string, for e.g. `FMT_COMPILE("{:.2f}")`.
+     * @return The converted iterator in string format.
+     */
+    template<class CompiledFormat, internal::EnableIf<internal::IsCompiledFormat<CompiledFormat>::value, int> = 0>
+    LZ_NODISCARD std::string toString(const StringView delimiter, const CompiledFormat& fmt) const {
+        std::string result;
+        internal::toStringFormatted(result, _begin, _end, delimiter, internal::CompiledFormatFn<CompiledFormat>{ fmt });
+        return result;
+    }
+#    endif // LZ_STANDALONE
+
+#    ifdef LZ_HAS_EXECUTION
+    /**
+     * Converts a random access view to a string in parallel, with a given delimiter. The view is split into blocks, which are
+     * formatted on separate threads and then copied into a string that is allocated once. Other views are converted sequentially.
+     * Example: `lz::range(100'000'000).toString(",", "{}", pool.executor())`.
+     * @param delimiter The delimiter between the previous value and the next.
+     * @param fmt The format args. (`{}` is default, not applicable if std::format isn't available or LZ_STANDALONE is defined)
+     * @param execution The execution policy. Must be one of `std::execution`'s tags or a `lz::ThreadPoolExecutor`.
+     * @return The converted iterator in string format.
+     */
+    template<class Execution>
+#        if defined(LZ_HAS_FORMAT) || !defined(LZ_STANDALONE)
+    LZ_NODISCARD std::string toString(const StringView delimiter, const StringView fmt, Execution execution) const {
+        if constexpr (internal::checkForwardAndPolicies<Execution, LzIterator>() || !IsRandomAccess<LzIterator>::value) {
+            static_cast<void>(execution);
+            return toString(delimiter, fmt);
+        }
+        else {
+            return internal::parallelToString(execution, _begin, _end, delimiter, fmt);
+        }
+    }
+#        else
+    LZ_NODISCARD std::string toString(const StringView delimiter, Execution execution) const {
+        if constexpr (internal::checkForwardAndPolicies<Execution, LzIterator>() || !IsRandomAccess<LzIterator>::value) {
+            static_cast<void>(execution);
+            return toString(delimiter);
+        }
+        else {
+            return internal::parallelToString(execution, _begin, _end, delimiter, internal::DefaultFormatFn());
+        }
+    }
+#        endif // LZ_HAS_FORMAT
+#    endif // LZ_HAS_EXECUTION
+
+    /**
+     * Formats the view, with a given delimiter, into an output iterator, without creating a string of the whole view first. The
+     * elements are formatted into a small buffer, which is copied to `out` every time it is full. Example:
+     * `lz::range(4).formatTo(std::back_inserter(str), ", ")` appends 0, 1, 2, 3 to `str`.
+     * @param out The output iterator to write the characters to.
+     * @param delimiter The delimiter between the previous value and the next.
+     * @param fmt The format args. (`{}` is default, not applicable if std::format isn't available or LZ_STANDALONE is defined)
+     * @return The output iterator past the last character that was written.
+     */
+    template<class OutputIterator>
+#    if defined(LZ_HAS_FORMAT) || !defined(LZ_STANDALONE)
+    OutputIterator formatTo(OutputIterator out, const StringView delimiter = "", const StringView fmt = "{}") const {
+        internal::IteratorSink<OutputIterator> sink(std::move(out));
+        internal::writeFormatted(sink, _begin, _end, delimiter, fmt, internal::formatToBufferSize);
+#    else
+    OutputIterator formatTo(OutputIterator out, const StringView delimiter = "") const {
+        internal::IteratorSink<OutputIterator> sink(std::move(out));
+        internal::writeFormatted(sink, _begin, _end, delimiter, internal::DefaultFormatFn(), internal::formatToBufferSize);
+#    endif // LZ_HAS_FORMAT
+        return sink.get();
+    }
+
+#    if !defined(LZ_STANDALONE)
+    /**
+     * Formats the view, with a given delimiter, directly into the end of `buffer`, for e.g. a `fmt::memory_buffer`.
+     * @param buffer The buffer to append the characters to.
+     * @param delimiter The delimiter between the previous value and the next.
+     * @param fmt The format args. (`{}` is default)
+     */
+    template<std::size_t Size, class Allocator>
+    void formatTo(fmt::basic_memory_buffer<char, Size, Allocator>& buffer, const StringView delimiter = "",
+                  const StringView fmt = "{}") const {
+        internal::toStringImpl(buffer, _begin, _end, delimiter, fmt);
+    }
+#    endif // LZ_STANDALONE
+
+    /**
+     * Writes the view, with a given delimiter, to a `std::FILE*`, a file descriptor or a `std::ostream`. The elements are
+     * formatted into a buffer of `bufferSize` characters, which is written every time it is full, so that the whole string is
+     * never in memory. Example: `lz::range(4).writeTo(stdout, ", ")` prints 0, 1, 2, 3.
+     * @param output The `std::FILE*`, file descriptor or `std::ostream` to write to. Writing to a file descriptor requires
+     * Lz/FileDescriptor.hpp.
+     * @param delimiter The delimiter between the previous value and the next.
+     * @param fmt The format args. (`{}` is default, not applicable if std::format isn't available or LZ_STANDALONE is defined)
+     * @param bufferSize The amount of characters to write at once.
+     * @throws `std::system_error` if writing to a `std::FILE*` or file descriptor fails. A `std::ostream` sets its error state
+     * instead.
+     */
+    template<class Output>
+#    if defined(LZ_HAS_FORMAT) || !defined(LZ_STANDALONE)
+    auto writeTo(Output&& output, const StringView delimiter = "", const StringView fmt = "{}",
+                 const std::size_t bufferSize = 65536) const -> decltype(internal::SinkType<Output>(output), void()) {
+        internal::SinkType<Output> sink(output);
+        internal::writeFormatted(sink, _begin, _end, delimiter, fmt, bufferSize);
+#    else
+    auto writeTo(Output&& output, const StringView delimiter = "", const std::size_t bufferSize = 65536) const
+        -> decltype(internal::SinkType<Output>(output), void()) {
+        internal::SinkType<Output> sink(output);
+        internal::writeFormatted(sink, _begin, _end, delimiter, internal::DefaultFormatFn(), bufferSize);
+#    endif // LZ_HAS_FORMAT
+    }
+
     /**
      * Function to stream the iterator to an output stream e.g. `std::cout`.
      * @param o The stream object.
@@ -533,7 +927,9 @@ public:
      * @return The stream object by reference.
      */
     friend std::ostream& operator<<(std::ostream& o, const BasicIteratorView<LzIterator>& it) {
-        return o << it.toString(" ");
+        internal::OstreamSink sink(o);
+        internal::writeFormatted(sink, it._begin, it._end, " ", internal::DefaultFormatFn(), internal::formatToBufferSize);
+        return o;
     }
 
     /**
@@ -552,6 +948,15 @@ public:
         return static_cast<std::size_t>(distance());
     }
 
+    /**
+     * Returns the lower and upper bound of the length of the view, without iterating over it. Exact if the view is sized, e.g.
+     * for a `map` over a `std::vector`. The upper bound is `SizeHint::unbounded()` if it is unknown, e.g. for a `flatten`.
+     * @return The size hint of the view.
+     */
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHint() const {
+        return getSizeHint(_begin, _end);
+    }
+
     /**
      * Gets the nth position of the iterator from this sequence.
      * @param n The offset.
@@ -606,7 +1011,7 @@ equal(const IterableA& a, const IterableB& b, BinaryPredicate predicate = {}, Ex
         return std::equal(std::begin(a), std::end(a), std::begin(b), std::end(b), std::move(predicate));
     }
     else {
-        return std::equal(execution, std::begin(a), std::end(a), std::begin(b), std::end(b), std::move(predicate));
+        return internal::equal(execution, std::begin(a), std::end(a), std::begin(b), std::end(b), std::move(predicate));
     }
 }
 #    endif // LZ_HAS_EXECUTION
@@ -180,6 +180,9 @@ public:
         return tmp;
     }
 };
+
+template<class... Iterators>
+struct IsSized<CartesianProductIterator<Iterators...>> : IsAllSized<Iterators...> {};
 } // namespace internal
 
 /**
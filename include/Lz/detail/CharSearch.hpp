@@ -0,0 +1,265 @@
+#pragma once
+
+#ifndef LZ_CHAR_SEARCH_HPP
+#define LZ_CHAR_SEARCH_HPP
+
+#include "LzTools.hpp"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#if defined(__AVX2__)
+#    include <immintrin.h>
+#    define LZ_HAS_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    include <emmintrin.h>
+#    define LZ_HAS_SSE2
+#endif // AVX2 / SSE2
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#    include <intrin.h>
+#endif // _MSC_VER
+
+namespace lz {
+namespace internal {
+// The amount of characters that is classified at once
+constexpr std::size_t scanBlockSize = 64;
+// The longest delimiter that is matched using the block scanner
+constexpr std::size_t maxScanDelimiterLength = 4;
+
+inline unsigned countTrailingZeros(const std::uint64_t value) noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+#    if defined(_M_X64) || defined(_M_ARM64)
+    unsigned long index = 0;
+    _BitScanForward64(&index, value);
+    return static_cast<unsigned>(index);
+#    else
+    unsigned long index = 0;
+    if (_BitScanForward(&index, static_cast<unsigned long>(value))) {
+        return static_cast<unsigned>(index);
+    }
+    _BitScanForward(&index, static_cast<unsigned long>(value >> 32));
+    return static_cast<unsigned>(index) + 32;
+#    endif // 64 bit
+#else
+    return static_cast<unsigned>(__builtin_ctzll(value));
+#endif // _MSC_VER
+}
+
+// Bit i is set if data[i] == c, for i in [0, scanBlockSize). Requires scanBlockSize readable characters
+inline std::uint64_t charBlockMask(const char* data, const char c) noexcept {
+#if defined(LZ_HAS_AVX2)
+    const __m256i needle = _mm256_set1_epi8(c);
+    const auto low = _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)), needle));
+    const auto high =
+        _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 32)), needle));
+    return static_cast<std::uint64_t>(static_cast<std::uint32_t>(low)) |
+           (static_cast<std::uint64_t>(static_cast<std::uint32_t>(high)) << 32);
+#elif defined(LZ_HAS_SSE2)
+    const __m128i needle = _mm_set1_epi8(c);
+    std::uint64_t mask = 0;
+    for (std::size_t i = 0; i < scanBlockSize; i += 16) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        mask |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle)))) << i;
+    }
+    return mask;
+#else
+    std::uint64_t mask = 0;
+    for (std::size_t i = 0; i < scanBlockSize; ++i) {
+        mask |= static_cast<std::uint64_t>(data[i] == c) << i;
+    }
+    return mask;
+#endif // LZ_HAS_AVX2
+}
+
+/**
+ * Bit i is set if the delimiter of `length` (1 up to and including `maxScanDelimiterLength`) characters starts at data[i], for i
+ * in [0, scanBlockSize). Requires scanBlockSize + length - 1 readable characters.
+ */
+inline std::uint64_t delimiterBlockMask(const char* data, const char* delimiter, const std::size_t length) noexcept {
+    std::uint64_t mask = charBlockMask(data, delimiter[0]);
+    for (std::size_t i = 1; i < length && mask != 0; ++i) {
+        mask &= charBlockMask(data + i, delimiter[i]);
+    }
+    return mask;
+}
+
+// Same as above, but only for the first `count` (< scanBlockSize) positions, for the last block of a string
+inline std::uint64_t
+delimiterTailMask(const char* data, const std::size_t count, const char* delimiter, const std::size_t length) noexcept {
+    std::uint64_t mask = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        std::size_t j = 0;
+        while (j < length && data[i + j] == delimiter[j]) {
+            ++j;
+        }
+        mask |= static_cast<std::uint64_t>(j == length) << i;
+    }
+    return mask;
+}
+
+/**
+ * The delimiter positions of the block that was scanned last. Positions [base, end) have been scanned, and bit i of `mask` is set
+ * if a delimiter starts at base + i.
+ */
+struct DelimiterBlock {
+    std::size_t base;
+    std::size_t end;
+    std::uint64_t mask;
+};
+
+/**
+ * Finds the first position >= `pos` in `data` where a delimiter of `length` (1 up to and including `maxScanDelimiterLength`)
+ * characters starts, or `std::string::npos` if there is none. The text is classified 64 characters at a time, and the matches of
+ * the last block are kept in `block`, so that consecutive searches with increasing positions classify every block only once.
+ */
+inline std::size_t findDelimiter(const char* data, const std::size_t size, std::size_t pos, const char* delimiter,
+                                 const std::size_t length, DelimiterBlock& block) noexcept {
+    if (pos >= block.base && pos < block.end) {
+        const std::uint64_t mask = block.mask & (~std::uint64_t{ 0 } << (pos - block.base));
+        if (mask != 0) {
+            block.mask = mask;
+            return block.base + countTrailingZeros(mask);
+        }
+        pos = block.end;
+    }
+    for (; pos + scanBlockSize + length - 1 <= size; pos += scanBlockSize) {
+        const std::uint64_t mask = delimiterBlockMask(data + pos, delimiter, length);
+        if (mask != 0) {
+            block = { pos, pos + scanBlockSize, mask };
+            return pos + countTrailingZeros(mask);
+        }
+    }
+    if (pos + length > size) {
+        return std::string::npos;
+    }
+    const std::size_t count = size - length + 1 - pos;
+    block = { pos, pos + count, delimiterTailMask(data + pos, count, delimiter, length) };
+    return block.mask != 0 ? pos + countTrailingZeros(block.mask) : std::string::npos;
+}
+
+/**
+ * Boyer-Moore-Horspool searcher for delimiters that are too long for `findDelimiter`. The skip table is built once, after which
+ * every search compares the last character of the window first, and shifts the window by up to the length of the delimiter on a
+ * mismatch.
+ */
+class HorspoolSearcher {
+    std::string _pattern;
+    std::array<std::size_t, 256> _skip{};
+
+public:
+    explicit HorspoolSearcher(std::string pattern) : _pattern(std::move(pattern)) {
+        _skip.fill(_pattern.size());
+        for (std::size_t i = 0; i + 1 < _pattern.size(); ++i) {
+            _skip[static_cast<unsigned char>(_pattern[i])] = _pattern.size() - 1 - i;
+        }
+    }
+
+    LZ_NODISCARD const std::string& pattern() const noexcept {
+        return _pattern;
+    }
+
+    // Finds the first position >= `pos` in `data` where the pattern starts, or `std::string::npos` if there is none
+    LZ_NODISCARD std::size_t find(const char* data, const std::size_t size, std::size_t pos) const noexcept {
+        const std::size_t last = _pattern.size() - 1;
+        const char lastChar = _pattern[last];
+        while (pos + last < size) {
+            const char c = data[pos + last];
+            if (c == lastChar && std::memcmp(data + pos, _pattern.data(), last) == 0) {
+                return pos;
+            }
+            pos += _skip[static_cast<unsigned char>(c)];
+        }
+        return std::string::npos;
+    }
+};
+
+/**
+ * A set of characters, stored as a 256 bit bitmap. Sets of up to `maxVectorChars` characters (like whitespace or `,;|`) are
+ * classified 16 or 32 characters at a time by comparing with every character of the set, larger sets use the bitmap per
+ * character.
+ */
+class CharSet {
+public:
+    static constexpr std::size_t maxVectorChars = 8;
+
+private:
+    std::array<std::uint64_t, 4> _bitmap{};
+    std::array<char, maxVectorChars> _chars{};
+    std::size_t _count{};
+
+public:
+    CharSet() = default;
+
+    CharSet(const char* chars, const std::size_t length) noexcept {
+        for (std::size_t i = 0; i < length; ++i) {
+            if (contains(chars[i])) {
+                continue;
+            }
+            const auto c = static_cast<unsigned char>(chars[i]);
+            _bitmap[c >> 6] |= std::uint64_t{ 1 } << (c & 63);
+            if (_count < maxVectorChars) {
+                _chars[_count] = chars[i];
+            }
+            ++_count;
+        }
+    }
+
+    LZ_NODISCARD bool contains(const char c) const noexcept {
+        const auto u = static_cast<unsigned char>(c);
+        return ((_bitmap[u >> 6] >> (u & 63)) & 1) != 0;
+    }
+
+    // Bit i is set if data[i] is in the set, for i in [0, count)
+    LZ_NODISCARD std::uint64_t tailMask(const char* data, const std::size_t count) const noexcept {
+        std::uint64_t mask = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            mask |= static_cast<std::uint64_t>(contains(data[i])) << i;
+        }
+        return mask;
+    }
+
+    // Bit i is set if data[i] is in the set, for i in [0, scanBlockSize). Requires scanBlockSize readable characters
+    LZ_NODISCARD std::uint64_t blockMask(const char* data) const noexcept {
+        if (_count == 0 || _count > maxVectorChars) {
+            return tailMask(data, scanBlockSize);
+        }
+        std::uint64_t mask = charBlockMask(data, _chars[0]);
+        for (std::size_t i = 1; i < _count; ++i) {
+            mask |= charBlockMask(data, _chars[i]);
+        }
+        return mask;
+    }
+};
+
+/**
+ * Finds the first position >= `pos` in [data, data + size) of which the character is (if `InSet` is true) or is not (if `InSet`
+ * is false) in `set`, or `std::string::npos` if there is none. `block` keeps the classification of the last 64 characters, like
+ * with `findDelimiter`, and can be shared between searches with both values of `InSet`.
+ */
+template<bool InSet>
+std::size_t
+findCharClass(const char* data, const std::size_t size, std::size_t pos, const CharSet& set, DelimiterBlock& block) noexcept {
+    while (true) {
+        if (pos >= block.base && pos < block.end) {
+            const std::size_t count = block.end - block.base;
+            const std::uint64_t valid = count == scanBlockSize ? ~std::uint64_t{ 0 } : (std::uint64_t{ 1 } << count) - 1;
+            const std::uint64_t mask = (InSet ? block.mask : ~block.mask & valid) & (~std::uint64_t{ 0 } << (pos - block.base));
+            if (mask != 0) {
+                return block.base + countTrailingZeros(mask);
+            }
+            pos = block.end;
+        }
+        if (pos >= size) {
+            return std::string::npos;
+        }
+        const std::size_t count = size - pos < scanBlockSize ? size - pos : scanBlockSize;
+        block = { pos, pos + count, count == scanBlockSize ? set.blockMask(data + pos) : set.tailMask(data + pos, count) };
+    }
+}
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_CHAR_SEARCH_HPP
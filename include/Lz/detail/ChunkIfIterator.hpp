@@ -35,7 +35,7 @@ private:
     LZ_CONSTEXPR_CXX_20 void findNext() {
 #ifdef LZ_HAS_EXECUTION
         if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
-            _subRangeEnd = std::find_if(_execution, _subRangeBegin, _end, _predicate);
+            _subRangeEnd = internal::findIf(_execution, _subRangeBegin, _end, _predicate);
         }
         else {
             _subRangeEnd = std::find_if(_subRangeBegin, _end, _predicate);
@@ -101,6 +101,11 @@ public:
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator!=(const ChunkIfIterator& lhs, const ChunkIfIterator& rhs) {
         return !(lhs == rhs); // NOLINT
     }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend SizeHint sizeHint(const ChunkIfIterator& begin, const ChunkIfIterator& end) {
+        // A chunk is created after every element that satisfies the predicate, plus the last one
+        return { begin != end ? 1u : 0u, addSaturated(getSizeHint(begin._subRangeBegin, begin._end).upper, 1) };
+    }
 };
 } // namespace internal
 } // namespace lz
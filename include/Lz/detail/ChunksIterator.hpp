@@ -110,7 +110,26 @@ public:
         }
         return tmp;
     }
+
+    template<class UnaryFunc>
+    LZ_CONSTEXPR_CXX_20 friend bool forEachUntil(ChunksIterator begin, const ChunksIterator& end, UnaryFunc&& func) {
+        for (; begin._subRangeBegin != end._subRangeBegin; ++begin) {
+            if (func(reference(begin._subRangeBegin, begin._subRangeEnd))) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend SizeHint sizeHint(const ChunksIterator& begin, const ChunksIterator& end) {
+        const auto hint = getSizeHint(begin._subRangeBegin, end._subRangeBegin);
+        const auto chunkSize = static_cast<std::size_t>(begin._chunkSize);
+        return { (hint.lower + chunkSize - 1) / chunkSize, hint.hasUpper() ? (hint.upper + chunkSize - 1) / chunkSize : hint.upper };
+    }
 };
+
+template<class Iterator>
+struct IsSized<ChunksIterator<Iterator>> : IsSized<Iterator> {};
 } // namespace internal
 
 /**
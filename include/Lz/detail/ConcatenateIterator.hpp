@@ -287,11 +287,33 @@ public:
 private:
     template<std::size_t... I>
     LZ_CONSTEXPR_CXX_20 difference_type minus(IndexSequence<I...>, const ConcatenateIterator& other) const {
-        const difference_type totals[] = { static_cast<difference_type>(std::get<I>(_iterators) -
-                                                                        std::get<I>(other._iterators))... };
+        const difference_type totals[] = { static_cast<difference_type>(
+            getIterLength(std::get<I>(other._iterators), std::get<I>(_iterators)))... };
         return std::accumulate(std::begin(totals), std::end(totals), difference_type{ 0 });
     }
 
+    template<std::size_t... I>
+    LZ_CONSTEXPR_CXX_20 SizeHint sizeHintImpl(const ConcatenateIterator& end, IndexSequence<I...>) const {
+        const SizeHint hints[] = { getSizeHint(std::get<I>(_iterators), std::get<I>(end._iterators))... };
+        SizeHint result(0, 0);
+        for (const SizeHint& hint : hints) {
+            result.lower = addSaturated(result.lower, hint.lower);
+            result.upper = addSaturated(result.upper, hint.upper);
+        }
+        return result;
+    }
+
+    template<class UnaryFunc, std::size_t... I>
+    LZ_CONSTEXPR_CXX_20 static bool
+    forEachUntilImpl(IterTuple& begin, IterTuple& end, UnaryFunc& func, IndexSequence<I...>) {
+        // Every iterable is pushed in its own loop, instead of checking which iterable is active for every element
+        bool stopped = false;
+        const int expand[] = { (stopped = stopped || forEachUntil(std::move(std::get<I>(begin)), std::move(std::get<I>(end)), func),
+                                0)... };
+        static_cast<void>(expand);
+        return stopped;
+    }
+
 public:
     LZ_CONSTEXPR_CXX_20 ConcatenateIterator(IterTuple iterators, IterTuple begin, IterTuple end) :
         _iterators(std::move(iterators)),
@@ -384,9 +406,32 @@ public:
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator>=(const ConcatenateIterator& a, const ConcatenateIterator& b) {
         return !(a < b); // NOLINT
     }
+
+    template<class UnaryFunc>
+    LZ_CONSTEXPR_CXX_20 friend bool forEachUntil(ConcatenateIterator begin, ConcatenateIterator end, UnaryFunc&& func) {
+        return forEachUntilImpl(begin._iterators, end._iterators, func, MakeIndexSequence<sizeof...(Iterators)>());
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend SizeHint sizeHint(const ConcatenateIterator& begin, const ConcatenateIterator& end) {
+        return begin.sizeHintImpl(end, MakeIndexSequence<sizeof...(Iterators)>());
+    }
 };
 
+template<class... Iterators>
+struct IsSized<ConcatenateIterator<Iterators...>> : IsAllSized<Iterators...> {};
 } // namespace internal
+
+/**
+ * Gets the distance between begin and end. If all underlying iterator types are sized, this is O(1).
+ * @param begin Beginning of the sequence.
+ * @param end Ending of the sequence.
+ * @return The length of the sequence.
+ */
+template<LZ_CONCEPT_ITERATOR... Iterators>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 typename internal::ConcatenateIterator<Iterators...>::difference_type
+distance(const internal::ConcatenateIterator<Iterators...>& begin, const internal::ConcatenateIterator<Iterators...>& end) {
+    return end - begin;
+}
 } // namespace lz
 
 #endif // LZ_CONCATENATE_ITERATOR_HPP
\ No newline at end of file
@@ -0,0 +1,274 @@
+#pragma once
+
+#ifndef LZ_CSV_ITERATOR_HPP
+#define LZ_CSV_ITERATOR_HPP
+
+#include "CharSearch.hpp"
+#include "LzTools.hpp"
+
+#include <cstring>
+#include <string>
+
+namespace lz {
+namespace internal {
+constexpr char csvQuote = '"';
+
+// Strings that do not own their characters, so that the records and fields of a temporary of them remain valid
+template<class T>
+struct IsCharView : std::false_type {};
+
+#ifdef LZ_HAS_STRING_VIEW
+template<>
+struct IsCharView<std::string_view> : std::true_type {};
+#endif // LZ_HAS_STRING_VIEW
+
+#ifndef LZ_STANDALONE
+template<>
+struct IsCharView<fmt::string_view> : std::true_type {};
+#endif // LZ_STANDALONE
+
+// Bit i of the result is the xor of bits [0, i] of `mask`, so that every bit between an opening and a closing quote is set
+inline std::uint64_t prefixXor(std::uint64_t mask) noexcept {
+    mask ^= mask << 1;
+    mask ^= mask << 2;
+    mask ^= mask << 4;
+    mask ^= mask << 8;
+    mask ^= mask << 16;
+    mask ^= mask << 32;
+    return mask;
+}
+
+/**
+ * The unquoted separators of the block that was scanned last. Positions [base, end) have been scanned, bit i of `mask` is set if
+ * an unquoted separator is at base + i, and `quoted` is true if a quoted section is still open at `end`.
+ */
+struct QuotedBlock {
+    std::size_t base;
+    std::size_t end;
+    std::uint64_t mask;
+    bool quoted;
+};
+
+/**
+ * Finds the first position >= `pos` in `data` of `separator` outside of quotes, or `std::string::npos` if there is none. Every
+ * block of 64 characters is classified at once: the prefix xor of the quote bitmap is the set of quoted characters, and the quote
+ * state at the end of a block is carried into the next one. An escaped quote (`""`) toggles the state twice, so it needs no
+ * special handling. `pos` must be 0, inside the last block, at the end of it, or directly after a separator that was found.
+ */
+inline std::size_t
+findUnquoted(const char* data, const std::size_t size, std::size_t pos, const char separator, QuotedBlock& block) noexcept {
+    while (true) {
+        if (pos >= block.base && pos < block.end) {
+            const std::uint64_t mask = block.mask & (~std::uint64_t{ 0 } << (pos - block.base));
+            if (mask != 0) {
+                return block.base + countTrailingZeros(mask);
+            }
+            pos = block.end;
+        }
+        if (pos >= size) {
+            return std::string::npos;
+        }
+        const bool quoted = pos == block.end && block.quoted;
+        const std::size_t count = size - pos < scanBlockSize ? size - pos : scanBlockSize;
+        std::uint64_t quotes = 0;
+        std::uint64_t separators = 0;
+        if (count == scanBlockSize) {
+            quotes = charBlockMask(data + pos, csvQuote);
+            separators = charBlockMask(data + pos, separator);
+        }
+        else {
+            quotes = delimiterTailMask(data + pos, count, &csvQuote, 1);
+            separators = delimiterTailMask(data + pos, count, &separator, 1);
+        }
+        const std::uint64_t inside = prefixXor(quotes) ^ (quoted ? ~std::uint64_t{ 0 } : 0);
+        block = { pos, pos + count, separators & ~inside, ((inside >> (count - 1)) & 1) != 0 };
+    }
+}
+
+/**
+ * Splits a CSV buffer into records (RFC 4180), without copying. Records are separated by line feeds that are not between quotes,
+ * so that a quoted field may contain line feeds. A carriage return directly before the line feed is not part of the record, and
+ * a last record without a line feed is returned as well.
+ */
+template<class SubString>
+class CsvRecordIterator {
+    const char* _data{ nullptr };
+    std::size_t _size{};
+    std::size_t _currentPos{}, _last{};
+    QuotedBlock _block{};
+
+    void findLineFeed() {
+        _last = findUnquoted(_data, _size, _currentPos, '\n', _block);
+    }
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = SubString;
+    using reference = SubString;
+    using difference_type = std::ptrdiff_t;
+    using pointer = FakePointerProxy<reference>;
+
+    CsvRecordIterator(const std::size_t startingPosition, const char* data, const std::size_t size) :
+        _data(data),
+        _size(size),
+        _currentPos(startingPosition),
+        _last(std::string::npos) {
+        if (startingPosition == 0 && size != 0) {
+            findLineFeed();
+        }
+    }
+
+    CsvRecordIterator() = default;
+
+    value_type operator*() const {
+        std::size_t end = _size;
+        if (_last != std::string::npos) {
+            end = _last != _currentPos && _data[_last - 1] == '\r' ? _last - 1 : _last;
+        }
+        return SubString(_data + _currentPos, end - _currentPos);
+    }
+
+    pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    constexpr friend bool operator!=(const CsvRecordIterator& a, const CsvRecordIterator& b) noexcept {
+        return a._currentPos != b._currentPos;
+    }
+
+    constexpr friend bool operator==(const CsvRecordIterator& a, const CsvRecordIterator& b) noexcept {
+        return !(a != b); // NOLINT
+    }
+
+    LZ_NODISCARD constexpr friend SizeHint sizeHint(const CsvRecordIterator& begin, const CsvRecordIterator& end) noexcept {
+        // Every record consumes at least one character, either of itself or of the line feed
+        return begin._currentPos < end._currentPos ? SizeHint(1, end._currentPos - begin._currentPos) : SizeHint(0, 0);
+    }
+
+    CsvRecordIterator& operator++() noexcept {
+        if (_last == std::string::npos || _last == _size - 1) {
+            // The last record, with or without a line feed
+            _currentPos = _size;
+            _last = std::string::npos;
+        }
+        else {
+            _currentPos = _last + 1;
+            findLineFeed();
+        }
+        return *this;
+    }
+
+    CsvRecordIterator operator++(int) noexcept {
+        CsvRecordIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+};
+
+/**
+ * Splits a CSV record into fields (RFC 4180). Fields are separated by delimiters that are not between quotes. The surrounding
+ * quotes of a quoted field are removed, and a field without escaped quotes (`""`) points into the record. Only fields with
+ * escaped quotes are unescaped, into a buffer that is kept in the iterator, so those are valid until the iterator is incremented
+ * or destroyed. The value type is therefore always an owning `std::string`, which is what collecting the fields creates. Unlike
+ * `lz::split`, a delimiter at the end of the record is followed by an empty field.
+ */
+template<class SubString>
+class CsvFieldIterator {
+    const char* _data{ nullptr };
+    std::size_t _size{};
+    // The field is [_currentPos, _last), where _last is the delimiter or the end of the record. The end iterator is at _size + 1
+    std::size_t _currentPos{}, _last{};
+    std::size_t _fieldBegin{}, _fieldLength{};
+    std::string _buffer{};
+    QuotedBlock _block{};
+    char _delimiter{};
+    bool _escaped{};
+
+    void findField() {
+        _last = findUnquoted(_data, _size, _currentPos, _delimiter, _block);
+        const std::size_t end = _last == std::string::npos ? _size : _last;
+        _fieldBegin = _currentPos;
+        _fieldLength = end - _currentPos;
+        _escaped = false;
+        if (_fieldLength == 0 || _data[_fieldBegin] != csvQuote) {
+            return;
+        }
+        ++_fieldBegin;
+        _fieldLength -= _fieldLength > 1 && _data[end - 1] == csvQuote ? 2 : 1;
+        const char* field = _data + _fieldBegin;
+        const auto* quote = static_cast<const char*>(std::memchr(field, csvQuote, _fieldLength));
+        if (quote == nullptr) {
+            return;
+        }
+        _buffer.assign(field, quote);
+        for (const char* last = field + _fieldLength; quote != last; ++quote) {
+            _buffer.push_back(*quote);
+            if (*quote == csvQuote && quote + 1 != last && quote[1] == csvQuote) {
+                ++quote;
+            }
+        }
+        _escaped = true;
+    }
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::string;
+    using reference = SubString;
+    using difference_type = std::ptrdiff_t;
+    using pointer = FakePointerProxy<reference>;
+
+    CsvFieldIterator(const char* data, const std::size_t size, const char delimiter, const bool end) :
+        _data(data),
+        _size(size),
+        _currentPos(end || size == 0 ? size + 1 : 0),
+        _last(std::string::npos),
+        _delimiter(delimiter) {
+        if (_currentPos == 0) {
+            findField();
+        }
+    }
+
+    CsvFieldIterator() = default;
+
+    reference operator*() const {
+        return _escaped ? SubString(_buffer.data(), _buffer.size()) : SubString(_data + _fieldBegin, _fieldLength);
+    }
+
+    pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    friend bool operator!=(const CsvFieldIterator& a, const CsvFieldIterator& b) noexcept {
+        return a._currentPos != b._currentPos;
+    }
+
+    friend bool operator==(const CsvFieldIterator& a, const CsvFieldIterator& b) noexcept {
+        return !(a != b); // NOLINT
+    }
+
+    LZ_NODISCARD friend SizeHint sizeHint(const CsvFieldIterator& begin, const CsvFieldIterator& end) noexcept {
+        // Every field but the last one consumes at least one character, the delimiter
+        return begin._currentPos < end._currentPos ? SizeHint(1, end._currentPos - begin._currentPos) : SizeHint(0, 0);
+    }
+
+    CsvFieldIterator& operator++() {
+        if (_last == std::string::npos) {
+            _currentPos = _size + 1;
+        }
+        else {
+            _currentPos = _last + 1;
+            findField();
+        }
+        return *this;
+    }
+
+    CsvFieldIterator operator++(int) {
+        CsvFieldIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_CSV_ITERATOR_HPP
@@ -83,7 +83,7 @@ public:
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend difference_type operator-(const EnumerateIterator& a, const EnumerateIterator& b) {
-        return a._iterator - b._iterator;
+        return getIterLength(b._iterator, a._iterator);
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator[](const difference_type offset) const {
@@ -113,8 +113,28 @@ public:
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator>=(const EnumerateIterator& a, const EnumerateIterator& b) {
         return !(a < b); // NOLINT
     }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend SizeHint sizeHint(const EnumerateIterator& begin, const EnumerateIterator& end) {
+        return getSizeHint(begin._iterator, end._iterator);
+    }
 };
+
+template<class Iterator, class Arithmetic>
+struct IsSized<EnumerateIterator<Iterator, Arithmetic>> : IsSized<Iterator> {};
 } // namespace internal
+
+/**
+ * Gets the distance between begin and end. If the underlying iterator type is sized, this is O(1).
+ * @param begin Beginning of the sequence.
+ * @param end Ending of the sequence.
+ * @return The length of the sequence.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, LZ_CONCEPT_INTEGRAL Arithmetic>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 typename internal::EnumerateIterator<Iterator, Arithmetic>::difference_type
+distance(const internal::EnumerateIterator<Iterator, Arithmetic>& begin,
+         const internal::EnumerateIterator<Iterator, Arithmetic>& end) {
+    return end - begin;
+}
 } // namespace lz
 
 #endif
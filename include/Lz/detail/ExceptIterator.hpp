@@ -3,12 +3,26 @@
 #ifndef LZ_EXCEPT_ITERATOR_HPP
 #define LZ_EXCEPT_ITERATOR_HPP
 
+#include "FlatHashSet.hpp"
 #include "FunctionContainer.hpp"
+#include "ParallelAlgorithms.hpp"
 
 #include <algorithm>
+#include <memory>
 
 namespace lz {
 namespace internal {
+template<class Compare, class T>
+struct IsLessThan : std::false_type {};
+
+template<class T>
+struct IsLessThan<std::less<T>, T> : std::true_type {};
+
+#ifndef LZ_HAS_CXX_11
+template<class T>
+struct IsLessThan<std::less<>, T> : std::true_type {};
+#endif // LZ_HAS_CXX_11
+
 #ifdef LZ_HAS_EXECUTION
 template<LZ_CONCEPT_ITERATOR Iterator, LZ_CONCEPT_ITERATOR IteratorToExcept, class Compare, class Execution>
 #else  // ^^^ has execution vvv ! has execution
@@ -24,48 +38,92 @@ public:
     using reference = typename IterTraits::reference;
     using pointer = FakePointerProxy<reference>;
 
+    // With the default `operator<`, equivalence is equality, so the elements to except can be looked up in a hash set instead
+    using UseHashSet = std::integral_constant<bool, IsLessThan<Compare, value_type>::value &&
+                                                        std::is_same<value_type, ValueType<IteratorToExcept>>::value &&
+                                                        IsHashable<value_type>::value>;
+    using HashSet = FlatHashSet<value_type>;
+
 private:
     Iterator _iterator{};
     Iterator _end{};
     IteratorToExcept _toExceptBegin{};
     IteratorToExcept _toExceptEnd{};
+    IteratorToExcept _cursor{};
+    IteratorToExcept _belowCursor{};
+    std::shared_ptr<const HashSet> _set{};
     mutable FunctionContainer<Compare> _compare{};
 
 #ifdef LZ_HAS_EXECUTION
     Execution _execution{};
 #endif // LZ_HAS_EXECUTION
+
+    // `_cursor` is the lower bound of the previous element and `_belowCursor` the element before it (or `_toExceptEnd`). As
+    // long as the elements are ascending, the cursor only moves forward. If an element is smaller than the previous one, the
+    // search is restarted from the beginning
+    LZ_CONSTEXPR_CXX_20 bool mergeContains(const value_type& value) {
+        if (_belowCursor != _toExceptEnd && !_compare(*_belowCursor, value)) {
+            _cursor = _toExceptBegin;
+            _belowCursor = _toExceptEnd;
+        }
+        _cursor = gallopLowerBound(std::move(_cursor), _toExceptEnd, value, _compare, _belowCursor);
+        return _cursor != _toExceptEnd && !_compare(value, *_cursor);
+    }
+
+    bool contains(const value_type& value, std::true_type /* useHashSet */) const {
+        return _set->contains(value);
+    }
+
+    LZ_CONSTEXPR_CXX_20 bool contains(const value_type& value, std::false_type /* useHashSet */) {
+        return mergeContains(value);
+    }
+
+#ifdef LZ_HAS_EXECUTION
+    // Used by the parallel algorithms, which cannot share the cursor
+    bool concurrentContains(const value_type& value) const {
+        if constexpr (UseHashSet::value) {
+            return _set->contains(value);
+        }
+        else {
+            return std::binary_search(_toExceptBegin, _toExceptEnd, value, _compare);
+        }
+    }
+#endif // LZ_HAS_EXECUTION
+
     LZ_CONSTEXPR_CXX_20 void find() {
 #ifdef LZ_HAS_EXECUTION
         if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
-            _iterator = std::find_if(std::move(_iterator), _end, [this](const value_type& value) {
-                return !std::binary_search(_toExceptBegin, _toExceptEnd, value, _compare);
-            });
+            _iterator = std::find_if(std::move(_iterator), _end,
+                                     [this](const value_type& value) { return !contains(value, UseHashSet()); });
         }
         else { // NOLINT
-            _iterator = std::find_if(_execution, std::move(_iterator), _end, [this](const value_type& value) {
-                return !std::binary_search(_toExceptBegin, _toExceptEnd, value, _compare);
-            });
+            _iterator = internal::findIf(_execution, std::move(_iterator), _end,
+                                         [this](const value_type& value) { return !concurrentContains(value); });
         }
 #else  // ^^^ has execution vvv ! has execution
-        _iterator = std::find_if(std::move(_iterator), _end, [this](const value_type& value) {
-            return !std::binary_search(_toExceptBegin, _toExceptEnd, value, _compare);
-        });
+        _iterator = std::find_if(std::move(_iterator), _end,
+                                 [this](const value_type& value) { return !contains(value, UseHashSet()); });
 #endif // LZ_HAS_EXECUTION
     }
 
 public:
     constexpr ExceptIterator() = default;
 
+    // `set` must contain [toExceptBegin, toExceptEnd) if `UseHashSet` is true, and is unused otherwise
 #ifdef LZ_HAS_EXECUTION
     LZ_CONSTEXPR_CXX_20 ExceptIterator(Iterator begin, Iterator end, IteratorToExcept toExceptBegin, IteratorToExcept toExceptEnd,
-                                       Compare compare, Execution execution) :
+                                       std::shared_ptr<const HashSet> set, Compare compare, Execution execution) :
 #else  // ^^^ has execution vvv ! has execution
-    ExceptIterator(Iterator begin, Iterator end, IteratorToExcept toExceptBegin, IteratorToExcept toExceptEnd, Compare compare) :
+    ExceptIterator(Iterator begin, Iterator end, IteratorToExcept toExceptBegin, IteratorToExcept toExceptEnd,
+                   std::shared_ptr<const HashSet> set, Compare compare) :
 #endif // LZ_HAS_EXECUTION
         _iterator(std::move(begin)),
         _end(std::move(end)),
-        _toExceptBegin(std::move(toExceptBegin)),
-        _toExceptEnd(std::move(toExceptEnd)),
+        _toExceptBegin(toExceptBegin),
+        _toExceptEnd(toExceptEnd),
+        _cursor(std::move(toExceptBegin)),
+        _belowCursor(std::move(toExceptEnd)),
+        _set(std::move(set)),
         _compare(std::move(compare))
 #ifdef LZ_HAS_EXECUTION
         ,
@@ -105,6 +163,10 @@ public:
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator==(const ExceptIterator& a, const ExceptIterator& b) {
         return !(a != b); // NOLINT
     }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend SizeHint sizeHint(const ExceptIterator& begin, const ExceptIterator& end) {
+        return { begin != end ? 1u : 0u, getSizeHint(begin._iterator, end._iterator).upper };
+    }
 };
 } // namespace internal
 } // namespace lz
@@ -108,7 +108,35 @@ public:
         tmp._iterator = next(std::move(tmp._iterator), offset);
         return tmp;
     }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend SizeHint sizeHint(const ExcludeIterator& begin, const ExcludeIterator& end) {
+        const auto hint = getSizeHint(begin._iterator, end._iterator);
+        const auto excluded = static_cast<std::size_t>(begin._index < begin._to ? begin._to - begin._from : 0);
+        return { hint.lower > excluded ? hint.lower - excluded : 0, hint.upper };
+    }
+
+    template<class UnaryFunc>
+    LZ_CONSTEXPR_CXX_20 friend bool forEachUntil(ExcludeIterator begin, ExcludeIterator end, UnaryFunc&& func) {
+        using lz::next;
+        using std::next;
+        // Push [begin, from) and [to, end) separately, so that the index doesn't have to be checked for every element
+        for (; begin._index < begin._from; ++begin._iterator, ++begin._index) {
+            if (begin._iterator == end._iterator) {
+                return false;
+            }
+            if (func(*begin._iterator)) {
+                return true;
+            }
+        }
+        if (begin._index == begin._from) {
+            begin._iterator = next(std::move(begin._iterator), begin._to - begin._from);
+        }
+        return forEachUntil(std::move(begin._iterator), std::move(end._iterator), func);
+    }
 };
+
+template<class Iterator>
+struct IsSized<ExcludeIterator<Iterator>> : IsSized<Iterator> {};
 } // namespace internal
 
 template<LZ_CONCEPT_ITERATOR Iterator>
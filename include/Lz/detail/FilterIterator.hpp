@@ -5,6 +5,7 @@
 
 #include "FunctionContainer.hpp"
 #include "LzTools.hpp"
+#include "ParallelAlgorithms.hpp"
 
 #include <algorithm>
 
@@ -32,7 +33,7 @@ public:
             return std::find_if(std::move(first), std::move(last), _predicate);
         }
         else {
-            return std::find_if(_execution, std::move(first), std::move(last), _predicate);
+            return internal::findIf(_execution, std::move(first), std::move(last), _predicate);
         }
 #else  // ^^^lz has execution vvv ! lz has execution
         return std::find_if(std::move(first), std::move(last), _predicate);
@@ -112,7 +113,51 @@ public:
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator==(const FilterIterator& a, const FilterIterator& b) {
         return !(a != b); // NOLINT
     }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend SizeHint sizeHint(const FilterIterator& begin, const FilterIterator& end) {
+        return { begin != end ? 1u : 0u, getSizeHint(begin._iterator, end._iterator).upper };
+    }
+
+    template<class UnaryFunc>
+    LZ_CONSTEXPR_CXX_20 friend bool forEachUntil(FilterIterator begin, FilterIterator end, UnaryFunc&& func) {
+        // begin already points to an element that satisfies the predicate, so it doesn't need to be checked again
+        if (begin._iterator == end._iterator) {
+            return false;
+        }
+        if (func(*begin._iterator)) {
+            return true;
+        }
+        ++begin._iterator;
+        return forEachUntil(std::move(begin._iterator), std::move(end._iterator), [&begin, &func](reference value) {
+            return begin._predicate(value) && func(std::forward<reference>(value));
+        });
+    }
+
+#ifdef LZ_HAS_EXECUTION
+    LZ_NODISCARD friend Compaction<Execution, Iterator> compact(const FilterIterator& begin, const FilterIterator& end) {
+        return compact(begin, end, begin._execution);
+    }
+
+    template<class Policy>
+    LZ_NODISCARD friend Compaction<Policy, Iterator>
+    compact(const FilterIterator& begin, const FilterIterator& end, const Policy execution) {
+        return { execution, begin._iterator, end._iterator, begin._predicate };
+    }
+
+    template<class Policy, class OutputIterator>
+    friend void scatter(const FilterIterator& begin, Compaction<Policy, Iterator>& compaction, const OutputIterator& output) {
+        compaction.scatter(begin._iterator, output);
+    }
+#endif // LZ_HAS_EXECUTION
 };
+
+#ifdef LZ_HAS_EXECUTION
+// With a parallel policy, a filter over a random access sequence is collected using a parallel compaction instead of a parallel
+// find per element
+template<class Iterator, class UnaryPredicate, class Execution>
+struct IsCompactable<FilterIterator<Iterator, UnaryPredicate, Execution>>
+    : std::integral_constant<bool, !IsSequencedPolicyV<Execution> && IsRandomAccess<Iterator>::value> {};
+#endif // LZ_HAS_EXECUTION
 } // namespace internal
 } // namespace lz
 
@@ -0,0 +1,83 @@
+#pragma once
+
+#ifndef LZ_FLAT_HASH_SET_HPP
+#define LZ_FLAT_HASH_SET_HPP
+
+#include "LzTools.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace lz {
+namespace internal {
+template<class T, class = void>
+struct IsHashable : std::false_type {};
+
+template<class T>
+struct IsHashable<T, decltype(static_cast<void>(std::hash<T>()(std::declval<const T&>())))>
+    : std::is_convertible<decltype(std::declval<const T&>() == std::declval<const T&>()), bool> {};
+
+// Amount of slots for `count` entries: a power of two, at most half full
+inline std::size_t hashCapacity(const std::size_t count) noexcept {
+    std::size_t capacity = 8;
+    while (capacity < count * 2) {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+// Fibonacci hashing, so that identity hashes (like std::hash<int>) are spread over the table as well
+template<class Key>
+std::size_t hashSlot(const Key& key, const std::size_t mask) {
+    const auto hash = static_cast<std::uint64_t>(std::hash<Key>()(key)) * 0x9E3779B97F4A7C15ull;
+    return static_cast<std::size_t>(hash >> 32) & mask;
+}
+
+/**
+ * Open addressing hash set (linear probing) that is built once and is read only afterwards, so that it can be shared by multiple
+ * iterators (and threads). Keys are compared using `operator==` and hashed using `std::hash`.
+ */
+template<class Key>
+class FlatHashSet {
+    static constexpr std::size_t npos = (std::numeric_limits<std::size_t>::max)();
+
+    std::vector<Key> _keys;
+    std::vector<std::size_t> _slots;
+    std::size_t _mask{};
+
+public:
+    template<class Iterator>
+    FlatHashSet(Iterator begin, const Iterator& end) : _keys(begin, end) {
+        _slots.assign(hashCapacity(_keys.size()), npos);
+        _mask = _slots.size() - 1;
+        for (std::size_t entry = 0; entry < _keys.size(); ++entry) {
+            std::size_t slot = hashSlot(_keys[entry], _mask);
+            while (_slots[slot] != npos && !(_keys[_slots[slot]] == _keys[entry])) {
+                slot = (slot + 1) & _mask;
+            }
+            if (_slots[slot] == npos) {
+                _slots[slot] = entry;
+            }
+        }
+    }
+
+    LZ_NODISCARD bool contains(const Key& key) const {
+        std::size_t slot = hashSlot(key, _mask);
+        while (_slots[slot] != npos) {
+            if (_keys[_slots[slot]] == key) {
+                return true;
+            }
+            slot = (slot + 1) & _mask;
+        }
+        return false;
+    }
+};
+
+template<class Key>
+constexpr std::size_t FlatHashSet<Key>::npos;
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_FLAT_HASH_SET_HPP
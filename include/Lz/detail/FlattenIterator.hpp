@@ -167,6 +167,11 @@ public:
         tmp._current = next(std::move(tmp._current), offset);
         return tmp;
     }
+
+    template<class UnaryFunc>
+    LZ_CONSTEXPR_CXX_20 friend bool forEachUntil(FlattenWrapper begin, FlattenWrapper end, UnaryFunc&& func) {
+        return forEachUntil(std::move(begin._current), std::move(end._current), func);
+    }
 };
 
 template<class Iterator, int N>
@@ -316,6 +321,25 @@ public:
         tmp._innerIter = tmp._innerIter + offset;
         return tmp;
     }
+
+    template<class UnaryFunc>
+    LZ_CONSTEXPR_CXX_20 friend bool forEachUntil(FlattenIterator begin, FlattenIterator end, UnaryFunc&& func) {
+        // Every inner range is pushed as a whole, instead of checking for the end of the inner range for every element
+        while (begin._outerIter != end._outerIter) {
+            const auto innerEnd = std::end(*begin._outerIter);
+            if (forEachUntil(std::move(begin._innerIter), Inner(innerEnd, std::begin(*begin._outerIter), innerEnd), func)) {
+                return true;
+            }
+            ++begin._outerIter;
+            if (!begin._outerIter.hasSome()) {
+                begin._innerIter = {};
+                break;
+            }
+            const auto innerBegin = std::begin(*begin._outerIter);
+            begin._innerIter = { innerBegin, innerBegin, std::end(*begin._outerIter) };
+        }
+        return forEachUntil(std::move(begin._innerIter), std::move(end._innerIter), func);
+    }
 };
 
 template<class Iterator>
@@ -396,6 +420,11 @@ public:
         tmp._range = tmp._range + offset;
         return tmp;
     }
+
+    template<class UnaryFunc>
+    LZ_CONSTEXPR_CXX_20 friend bool forEachUntil(FlattenIterator begin, FlattenIterator end, UnaryFunc&& func) {
+        return forEachUntil(std::move(begin._range), std::move(end._range), func);
+    }
 };
 } // namespace internal
 
@@ -41,7 +41,7 @@ class GroupByIterator {
                                         [this, &next](const IterValueType& v) { return !_comparer(v, next); });
         }
         else {
-            _subRangeEnd = std::find_if(_execution, std::move(_subRangeEnd), _end,
+            _subRangeEnd = internal::findIf(_execution, std::move(_subRangeEnd), _end,
                                         [this, &next](const IterValueType& v) { return !_comparer(v, next); });
         }
 #else
@@ -108,6 +108,10 @@ public:
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator==(const GroupByIterator& lhs, const GroupByIterator& rhs) {
         return !(lhs != rhs); // NOLINT
     }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend SizeHint sizeHint(const GroupByIterator& begin, const GroupByIterator& end) {
+        return { begin != end ? 1u : 0u, getSizeHint(begin._subRangeBegin, begin._end).upper };
+    }
 };
 } // namespace internal
 } // namespace lz
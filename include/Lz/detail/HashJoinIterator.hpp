@@ -0,0 +1,228 @@
+#pragma once
+
+#ifndef LZ_HASH_JOIN_ITERATOR_HPP
+#define LZ_HASH_JOIN_ITERATOR_HPP
+
+#include "FlatHashSet.hpp"
+#include "FunctionContainer.hpp"
+
+#include <memory>
+
+namespace lz {
+namespace internal {
+/**
+ * Open addressing hash table (linear probing) over one side of a hash join. Every slot refers to the first entry of a distinct
+ * key, entries with the same key are chained in their original order, so that all matches of a key can be visited in order.
+ */
+template<class Iterator, class Key>
+class HashJoinTable {
+    std::vector<Iterator> _iterators;
+    std::vector<Key> _keys;
+    std::vector<std::size_t> _next;
+    std::vector<std::size_t> _slots;
+    std::size_t _mask{};
+
+public:
+    static constexpr std::size_t npos = (std::numeric_limits<std::size_t>::max)();
+
+    template<class Selector>
+    HashJoinTable(Iterator begin, const Iterator& end, Selector& selector) {
+        for (; begin != end; ++begin) {
+            _iterators.push_back(begin);
+            _keys.push_back(static_cast<Key>(selector(*begin)));
+        }
+
+        _slots.assign(hashCapacity(_keys.size()), npos);
+        _mask = _slots.size() - 1;
+        _next.assign(_keys.size(), npos);
+
+        // Inserting in reverse order and prepending to the chains keeps the entries of every key in their original order
+        for (std::size_t entry = _keys.size(); entry-- > 0;) {
+            std::size_t slot = hashSlot(_keys[entry], _mask);
+            while (_slots[slot] != npos && !(_keys[_slots[slot]] == _keys[entry])) {
+                slot = (slot + 1) & _mask;
+            }
+            _next[entry] = _slots[slot];
+            _slots[slot] = entry;
+        }
+    }
+
+    // Returns the first entry with key `key`, or `npos` if there is none
+    LZ_NODISCARD std::size_t find(const Key& key) const {
+        std::size_t slot = hashSlot(key, _mask);
+        while (_slots[slot] != npos) {
+            if (_keys[_slots[slot]] == key) {
+                return _slots[slot];
+            }
+            slot = (slot + 1) & _mask;
+        }
+        return npos;
+    }
+
+    // Returns the next entry with the same key as `entry`, or `npos` if there is none
+    LZ_NODISCARD std::size_t next(const std::size_t entry) const {
+        return _next[entry];
+    }
+
+    LZ_NODISCARD const Iterator& iterator(const std::size_t entry) const {
+        return _iterators[entry];
+    }
+
+    LZ_NODISCARD std::size_t size() const noexcept {
+        return _iterators.size();
+    }
+};
+
+template<class Iterator, class Key>
+constexpr std::size_t HashJoinTable<Iterator, Key>::npos;
+
+template<class IterA, class IterB, class SelectorA, class SelectorB>
+using HashJoinKey = Decay<typename std::common_type<FunctionReturnType<SelectorA, RefType<IterA>>,
+                                                    FunctionReturnType<SelectorB, RefType<IterB>>>::type>;
+
+template<class IterA, class IterB, class ResultSelector, bool LeftOuter>
+struct HashJoinResult {
+    using type = FunctionReturnType<ResultSelector, RefType<IterA>, RefType<IterB>>;
+};
+
+template<class IterA, class IterB, class ResultSelector>
+struct HashJoinResult<IterA, IterB, ResultSelector, true> {
+    using type = FunctionReturnType<ResultSelector, RefType<IterA>, const ValueType<IterB>*>;
+};
+
+/**
+ * Iterator of a hash join. The hash table is built over one side (A or B), the other side is probed lazily. In left outer mode,
+ * the table is always built over B and every element of A that has no match is returned once, with a null pointer for B.
+ */
+template<class IterA, class IterB, class SelectorA, class SelectorB, class ResultSelector, bool LeftOuter>
+class HashJoinIterator {
+    using Key = HashJoinKey<IterA, IterB, SelectorA, SelectorB>;
+    using TableA = HashJoinTable<IterA, Key>;
+    using TableB = HashJoinTable<IterB, Key>;
+
+public:
+    using reference = typename HashJoinResult<IterA, IterB, ResultSelector, LeftOuter>::type;
+    using value_type = Decay<reference>;
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using pointer = FakePointerProxy<reference>;
+    using TableAPtr = std::shared_ptr<const TableA>;
+    using TableBPtr = std::shared_ptr<const TableB>;
+
+private:
+    static constexpr std::size_t npos = TableA::npos;
+
+    IterA _iterA{};
+    IterA _endA{};
+    IterB _iterB{};
+    IterB _endB{};
+    TableAPtr _tableA{};
+    TableBPtr _tableB{};
+    std::size_t _match{ npos };
+    mutable FunctionContainer<SelectorA> _selectorA{};
+    mutable FunctionContainer<SelectorB> _selectorB{};
+    mutable FunctionContainer<ResultSelector> _resultSelector{};
+
+    static reference dereference(const HashJoinIterator& it, std::false_type /* leftOuter */) {
+        if (it._tableA) {
+            return it._resultSelector(*it._tableA->iterator(it._match), *it._iterB);
+        }
+        return it._resultSelector(*it._iterA, *it._tableB->iterator(it._match));
+    }
+
+    static reference dereference(const HashJoinIterator& it, std::true_type /* leftOuter */) {
+        return it._resultSelector(*it._iterA, it._match == npos ? nullptr : std::addressof(*it._tableB->iterator(it._match)));
+    }
+
+    void findNext() {
+        if (_tableA) {
+            for (; _iterB != _endB; ++_iterB) {
+                _match = _tableA->find(static_cast<Key>(_selectorB(*_iterB)));
+                if (_match != npos) {
+                    return;
+                }
+            }
+            return;
+        }
+        for (; _iterA != _endA; ++_iterA) {
+            _match = _tableB->find(static_cast<Key>(_selectorA(*_iterA)));
+            if (_match != npos || LeftOuter) {
+                return;
+            }
+        }
+    }
+
+public:
+    // Exactly one of `tableA` and `tableB` must be set, the other side is probed
+    HashJoinIterator(IterA iterA, IterA endA, IterB iterB, IterB endB, TableAPtr tableA, TableBPtr tableB, SelectorA a,
+                     SelectorB b, ResultSelector resultSelector) :
+        _iterA(tableA ? endA : std::move(iterA)),
+        _endA(std::move(endA)),
+        _iterB(tableA ? std::move(iterB) : endB),
+        _endB(std::move(endB)),
+        _tableA(std::move(tableA)),
+        _tableB(std::move(tableB)),
+        _selectorA(std::move(a)),
+        _selectorB(std::move(b)),
+        _resultSelector(std::move(resultSelector)) {
+        findNext();
+    }
+
+    HashJoinIterator() = default;
+
+    LZ_NODISCARD reference operator*() const {
+        return dereference(*this, std::integral_constant<bool, LeftOuter>());
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    HashJoinIterator& operator++() {
+        if (_match != npos) {
+            _match = _tableA ? _tableA->next(_match) : _tableB->next(_match);
+            if (_match != npos) {
+                return *this;
+            }
+        }
+        if (_tableA) {
+            ++_iterB;
+        }
+        else {
+            ++_iterA;
+        }
+        findNext();
+        return *this;
+    }
+
+    HashJoinIterator operator++(int) {
+        HashJoinIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD friend bool operator==(const HashJoinIterator& a, const HashJoinIterator& b) {
+        return a._iterA == b._iterA && a._iterB == b._iterB && a._match == b._match;
+    }
+
+    LZ_NODISCARD friend bool operator!=(const HashJoinIterator& a, const HashJoinIterator& b) {
+        return !(a == b); // NOLINT
+    }
+
+    LZ_NODISCARD friend SizeHint sizeHint(const HashJoinIterator& begin, const HashJoinIterator& end) {
+        if (begin == end) {
+            return { 0, 0 };
+        }
+        const std::size_t tableSize = begin._tableA ? begin._tableA->size() : begin._tableB->size();
+        const SizeHint probe =
+            begin._tableA ? getSizeHint(begin._iterB, end._iterB) : getSizeHint(begin._iterA, end._iterA);
+        return { LeftOuter ? probe.lower : 1u, mulSaturated(probe.upper, tableSize) };
+    }
+};
+
+template<class IterA, class IterB, class SelectorA, class SelectorB, class ResultSelector, bool LeftOuter>
+constexpr std::size_t HashJoinIterator<IterA, IterB, SelectorA, SelectorB, ResultSelector, LeftOuter>::npos;
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_HASH_JOIN_ITERATOR_HPP
@@ -0,0 +1,263 @@
+#pragma once
+
+#ifndef LZ_INDEXED_SPLIT_ITERATOR_HPP
+#define LZ_INDEXED_SPLIT_ITERATOR_HPP
+
+#include "CharSearch.hpp"
+#include "LzTools.hpp"
+#include "ParallelAlgorithms.hpp"
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace lz {
+namespace internal {
+/**
+ * The positions of all delimiters in a string, as found by `SplitIterator`. Token i starts after delimiter i - 1 (or at 0) and
+ * ends at delimiter i (or at the end of the string), so that only one offset per token is stored. The index can be built in
+ * parallel: the string is split into blocks that are scanned independently, after which the per block offsets are concatenated
+ * using a prefix sum over their counts.
+ */
+class SplitIndex {
+    std::vector<std::size_t> _matches;
+    std::size_t _size{};
+    std::size_t _delimiterLength{};
+    std::size_t _tokens{};
+
+    // True if a proper prefix of the delimiter is also a suffix of it, in which case two occurrences can overlap (e.g. "aa")
+    static bool canOverlap(const char* delimiter, const std::size_t length) noexcept {
+        for (std::size_t border = 1; border < length; ++border) {
+            if (std::memcmp(delimiter, delimiter + length - border, border) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Appends the positions in [first, last) where the delimiter starts to `matches`. After every match, the search continues
+    // `step` characters further
+    static void scan(const char* data, const std::size_t size, const std::size_t first, const std::size_t last,
+                     const char* delimiter, const std::size_t length, const HorspoolSearcher* searcher, const std::size_t step,
+                     std::vector<std::size_t>& matches) {
+        const std::size_t limit = last + length - 1 < size ? last + length - 1 : size;
+        DelimiterBlock block{};
+        std::size_t pos = first;
+        while (true) {
+            pos = searcher != nullptr ? searcher->find(data, limit, pos)
+                                      : findDelimiter(data, limit, pos, delimiter, length, block);
+            if (pos == std::string::npos) {
+                return;
+            }
+            matches.push_back(pos);
+            pos += step;
+        }
+    }
+
+    void countTokens() {
+        if (_size == 0) {
+            _tokens = 0;
+            return;
+        }
+        // Like `SplitIterator`, a delimiter at the end of the string is not followed by an empty token
+        const bool endsWithDelimiter = !_matches.empty() && _matches.back() + _delimiterLength == _size;
+        _tokens = _matches.size() + 1 - static_cast<std::size_t>(endsWithDelimiter);
+    }
+
+    // An empty delimiter matches at every position without consuming any characters, so scanning for it would never end
+    static void checkDelimiter(const std::size_t length) {
+        if (length == 0) {
+            throw std::invalid_argument("lz::indexed: the delimiter cannot be empty");
+        }
+    }
+
+    static std::unique_ptr<HorspoolSearcher> makeSearcher(const char* delimiter, const std::size_t length) {
+        if (length <= maxScanDelimiterLength) {
+            return nullptr;
+        }
+        return std::unique_ptr<HorspoolSearcher>(new HorspoolSearcher(std::string(delimiter, length)));
+    }
+
+public:
+    SplitIndex(const char* data, const std::size_t size, const char* delimiter, const std::size_t length) :
+        _size(size),
+        _delimiterLength(length) {
+        checkDelimiter(length);
+        const auto searcher = makeSearcher(delimiter, length);
+        scan(data, size, 0, size, delimiter, length, searcher.get(), length, _matches);
+        countTokens();
+    }
+
+#ifdef LZ_HAS_EXECUTION
+    template<class Execution>
+    SplitIndex(Execution execution, const char* data, const std::size_t size, const char* delimiter, const std::size_t length) :
+        _size(size),
+        _delimiterLength(length) {
+        checkDelimiter(length);
+        const auto searcher = makeSearcher(delimiter, length);
+        // Every block is scanned from its own beginning, so if occurrences can overlap, all of them are collected and the ones
+        // that `SplitIterator` would skip are removed afterwards
+        const bool overlap = canOverlap(delimiter, length);
+        const std::size_t step = overlap ? 1 : length;
+        const std::size_t blocks = blockCount(threadCount(execution), size, std::size_t{ 1 } << 16);
+
+        std::vector<std::vector<std::size_t>> blockMatches(blocks);
+        parallelForEachBlock(execution, size, blocks,
+                             [data, size, delimiter, length, step, &searcher, &blockMatches](
+                                 const std::size_t block, const std::size_t first, const std::size_t last) {
+                                 scan(data, size, first, last, delimiter, length, searcher.get(), step, blockMatches[block]);
+                             });
+
+        std::vector<std::size_t> offsets(blocks + 1);
+        for (std::size_t block = 0; block < blocks; ++block) {
+            offsets[block + 1] = offsets[block] + blockMatches[block].size();
+        }
+        _matches.resize(offsets.back());
+        parallelForEachBlock(execution, blocks, blocks,
+                             [this, &blockMatches, &offsets](const std::size_t block, std::size_t, std::size_t) {
+                                 std::copy(blockMatches[block].begin(), blockMatches[block].end(),
+                                           _matches.begin() + static_cast<std::ptrdiff_t>(offsets[block]));
+                             });
+
+        if (overlap) {
+            std::size_t kept = 0;
+            std::size_t nextFree = 0;
+            for (const std::size_t match : _matches) {
+                if (match >= nextFree) {
+                    _matches[kept++] = match;
+                    nextFree = match + length;
+                }
+            }
+            _matches.resize(kept);
+        }
+        countTokens();
+    }
+#endif // LZ_HAS_EXECUTION
+
+    LZ_NODISCARD std::size_t size() const noexcept {
+        return _tokens;
+    }
+
+    LZ_NODISCARD std::size_t tokenBegin(const std::size_t token) const noexcept {
+        return token == 0 ? 0 : _matches[token - 1] + _delimiterLength;
+    }
+
+    LZ_NODISCARD std::size_t tokenEnd(const std::size_t token) const noexcept {
+        return token < _matches.size() ? _matches[token] : _size;
+    }
+};
+
+/**
+ * Random access iterator over the tokens of a `SplitIndex`. The index is shared by all copies of the iterator.
+ */
+template<class SubString>
+class IndexedSplitIterator {
+    const char* _data{ nullptr };
+    std::shared_ptr<const SplitIndex> _index{};
+    std::ptrdiff_t _current{};
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = SubString;
+    using reference = SubString;
+    using difference_type = std::ptrdiff_t;
+    using pointer = FakePointerProxy<reference>;
+
+    IndexedSplitIterator(const char* data, std::shared_ptr<const SplitIndex> index, const std::size_t current) :
+        _data(data),
+        _index(std::move(index)),
+        _current(static_cast<difference_type>(current)) {
+    }
+
+    IndexedSplitIterator() = default;
+
+    LZ_NODISCARD reference operator*() const {
+        const auto token = static_cast<std::size_t>(_current);
+        const std::size_t begin = _index->tokenBegin(token);
+        return SubString(_data + begin, _index->tokenEnd(token) - begin);
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    IndexedSplitIterator& operator++() noexcept {
+        ++_current;
+        return *this;
+    }
+
+    IndexedSplitIterator operator++(int) noexcept {
+        IndexedSplitIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    IndexedSplitIterator& operator--() noexcept {
+        --_current;
+        return *this;
+    }
+
+    IndexedSplitIterator operator--(int) noexcept {
+        IndexedSplitIterator tmp(*this);
+        --*this;
+        return tmp;
+    }
+
+    IndexedSplitIterator& operator+=(const difference_type offset) noexcept {
+        _current += offset;
+        return *this;
+    }
+
+    IndexedSplitIterator& operator-=(const difference_type offset) noexcept {
+        _current -= offset;
+        return *this;
+    }
+
+    LZ_NODISCARD IndexedSplitIterator operator+(const difference_type offset) const noexcept {
+        IndexedSplitIterator tmp(*this);
+        tmp += offset;
+        return tmp;
+    }
+
+    LZ_NODISCARD IndexedSplitIterator operator-(const difference_type offset) const noexcept {
+        IndexedSplitIterator tmp(*this);
+        tmp -= offset;
+        return tmp;
+    }
+
+    LZ_NODISCARD friend difference_type operator-(const IndexedSplitIterator& a, const IndexedSplitIterator& b) noexcept {
+        return a._current - b._current;
+    }
+
+    LZ_NODISCARD reference operator[](const difference_type offset) const {
+        return *(*this + offset);
+    }
+
+    LZ_NODISCARD friend bool operator==(const IndexedSplitIterator& a, const IndexedSplitIterator& b) noexcept {
+        return a._current == b._current;
+    }
+
+    LZ_NODISCARD friend bool operator!=(const IndexedSplitIterator& a, const IndexedSplitIterator& b) noexcept {
+        return !(a == b); // NOLINT
+    }
+
+    LZ_NODISCARD friend bool operator<(const IndexedSplitIterator& a, const IndexedSplitIterator& b) noexcept {
+        return a._current < b._current;
+    }
+
+    LZ_NODISCARD friend bool operator>(const IndexedSplitIterator& a, const IndexedSplitIterator& b) noexcept {
+        return b < a;
+    }
+
+    LZ_NODISCARD friend bool operator<=(const IndexedSplitIterator& a, const IndexedSplitIterator& b) noexcept {
+        return !(b < a); // NOLINT
+    }
+
+    LZ_NODISCARD friend bool operator>=(const IndexedSplitIterator& a, const IndexedSplitIterator& b) noexcept {
+        return !(a < b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_INDEXED_SPLIT_ITERATOR_HPP
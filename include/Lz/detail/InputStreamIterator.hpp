@@ -0,0 +1,271 @@
+#pragma once
+
+#ifndef LZ_INPUT_STREAM_ITERATOR_HPP
+#define LZ_INPUT_STREAM_ITERATOR_HPP
+
+#include "LzTools.hpp"
+
+#include <cstring>
+#include <istream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace lz {
+namespace internal {
+class IstreamSource {
+    std::istream* _stream{ nullptr };
+
+public:
+    explicit IstreamSource(std::istream& stream) noexcept : _stream(&stream) {
+    }
+
+    // Reads up to `count` characters into `data`. Returns 0 only at the end of the stream. Only waits for a single character, and
+    // then takes what is available, so that input from e.g. a pipe or a terminal is returned as soon as it arrives
+    std::size_t read(char* data, const std::size_t count) {
+        std::streamsize length = _stream->readsome(data, static_cast<std::streamsize>(count));
+        if (length == 0 && _stream->good()) {
+            _stream->read(data, 1);
+            length = _stream->gcount();
+            if (length != 0) {
+                length += _stream->readsome(data + 1, static_cast<std::streamsize>(count - 1));
+            }
+        }
+        return static_cast<std::size_t>(length);
+    }
+};
+
+/**
+ * Reads a source in large blocks into a reusable buffer. It is shared by all copies of the iterators over it, and by the byte
+ * and line iterators, so that they all continue where the other left off. Nothing is read until the first character or line is
+ * requested.
+ */
+template<class Source>
+class BufferedReader {
+    Source _source;
+    std::vector<char> _buffer;
+    // The unread characters are [_begin, _end)
+    std::size_t _begin{}, _end{};
+    std::size_t _lineBegin{}, _lineLength{};
+    bool _eof{};
+    bool _lineRead{};
+    bool _hasLine{};
+
+    // Moves the unread characters to the front of the buffer, and reads more after them. Returns false at the end of the source
+    bool fill() {
+        if (_eof) {
+            return false;
+        }
+        if (_begin != 0) {
+            std::memmove(_buffer.data(), _buffer.data() + _begin, _end - _begin);
+            _end -= _begin;
+            _begin = 0;
+        }
+        if (_end == _buffer.size()) {
+            // A line that doesn't fit in the buffer
+            _buffer.resize(_buffer.size() * 2);
+        }
+        const std::size_t count = _source.read(_buffer.data() + _end, _buffer.size() - _end);
+        if (count == 0) {
+            _eof = true;
+            return false;
+        }
+        _end += count;
+        return true;
+    }
+
+    bool readLine() {
+        std::size_t searched = 0;
+        while (true) {
+            const char* data = _buffer.data() + _begin;
+            const auto* lineFeed = static_cast<const char*>(std::memchr(data + searched, '\n', _end - _begin - searched));
+            if (lineFeed != nullptr) {
+                const auto length = static_cast<std::size_t>(lineFeed - data);
+                _lineBegin = _begin;
+                _lineLength = length != 0 && data[length - 1] == '\r' ? length - 1 : length;
+                _begin += length + 1;
+                return true;
+            }
+            searched = _end - _begin;
+            if (!fill()) {
+                break;
+            }
+        }
+        if (_begin == _end) {
+            return false;
+        }
+        // The last line, without a line feed
+        _lineBegin = _begin;
+        _lineLength = _end - _begin;
+        _begin = _end;
+        return true;
+    }
+
+public:
+    BufferedReader(Source source, const std::size_t bufferSize) :
+        _source(std::move(source)),
+        _buffer(bufferSize == 0 ? 1 : bufferSize) {
+    }
+
+    bool atEnd() {
+        return _begin == _end && !fill();
+    }
+
+    char current() const noexcept {
+        return _buffer[_begin];
+    }
+
+    void advance() noexcept {
+        ++_begin;
+    }
+
+    bool atLineEnd() {
+        if (!_lineRead) {
+            _hasLine = readLine();
+            _lineRead = true;
+        }
+        return !_hasLine;
+    }
+
+    // The current line, which is valid until the next call to `advanceLine`
+    const char* lineData() const noexcept {
+        return _buffer.data() + _lineBegin;
+    }
+
+    std::size_t lineLength() const noexcept {
+        return _lineLength;
+    }
+
+    void advanceLine() noexcept {
+        _lineRead = false;
+    }
+};
+
+/**
+ * Input iterator over the characters of a `BufferedReader`. Like `std::istreambuf_iterator`, two iterators are equal if both or
+ * neither of them are at the end of the source. A default constructed iterator is the end iterator.
+ */
+template<class Source>
+class InputStreamIterator {
+    std::shared_ptr<BufferedReader<Source>> _reader{};
+
+    bool atEnd() const {
+        return !_reader || _reader->atEnd();
+    }
+
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = char;
+    using reference = char;
+    using difference_type = std::ptrdiff_t;
+    using pointer = FakePointerProxy<reference>;
+
+    explicit InputStreamIterator(std::shared_ptr<BufferedReader<Source>> reader) noexcept : _reader(std::move(reader)) {
+    }
+
+    InputStreamIterator() = default;
+
+    LZ_NODISCARD const std::shared_ptr<BufferedReader<Source>>& reader() const noexcept {
+        return _reader;
+    }
+
+    reference operator*() const {
+        // Reads the next block if the buffer has been consumed
+        const bool end = atEnd();
+        LZ_ASSERT(!end, "cannot dereference the end of an input stream");
+        static_cast<void>(end);
+        return _reader->current();
+    }
+
+    pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    InputStreamIterator& operator++() {
+        // Reads the next block if the buffer has been consumed
+        const bool end = atEnd();
+        LZ_ASSERT(!end, "cannot increment the end of an input stream");
+        static_cast<void>(end);
+        _reader->advance();
+        return *this;
+    }
+
+    InputStreamIterator operator++(int) {
+        InputStreamIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    friend bool operator==(const InputStreamIterator& a, const InputStreamIterator& b) {
+        return a.atEnd() == b.atEnd();
+    }
+
+    friend bool operator!=(const InputStreamIterator& a, const InputStreamIterator& b) {
+        return !(a == b); // NOLINT
+    }
+};
+
+/**
+ * Input iterator over the lines of a `BufferedReader`. The line feed and a carriage return before it are not part of the lines.
+ * If `SubString` is a view, the lines point into the buffer of the reader, so they are only valid until the iterator is
+ * incremented. The value type is therefore always an owning `std::string`, which is what collecting the lines creates.
+ */
+template<class Source, class SubString>
+class InputStreamLineIterator {
+    std::shared_ptr<BufferedReader<Source>> _reader{};
+
+    bool atEnd() const {
+        return !_reader || _reader->atLineEnd();
+    }
+
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = std::string;
+    using reference = SubString;
+    using difference_type = std::ptrdiff_t;
+    using pointer = FakePointerProxy<reference>;
+
+    explicit InputStreamLineIterator(std::shared_ptr<BufferedReader<Source>> reader) noexcept : _reader(std::move(reader)) {
+    }
+
+    InputStreamLineIterator() = default;
+
+    reference operator*() const {
+        // Reads the next line if that hasn't been done yet
+        const bool end = atEnd();
+        LZ_ASSERT(!end, "cannot dereference the end of an input stream");
+        static_cast<void>(end);
+        return SubString(_reader->lineData(), _reader->lineLength());
+    }
+
+    pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    InputStreamLineIterator& operator++() {
+        // Reads the next line if that hasn't been done yet
+        const bool end = atEnd();
+        LZ_ASSERT(!end, "cannot increment the end of an input stream");
+        static_cast<void>(end);
+        _reader->advanceLine();
+        return *this;
+    }
+
+    InputStreamLineIterator operator++(int) {
+        InputStreamLineIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    friend bool operator==(const InputStreamLineIterator& a, const InputStreamLineIterator& b) {
+        return a.atEnd() == b.atEnd();
+    }
+
+    friend bool operator!=(const InputStreamLineIterator& a, const InputStreamLineIterator& b) {
+        return !(a == b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_INPUT_STREAM_ITERATOR_HPP
@@ -4,117 +4,117 @@
 #define LZ_JOIN_ITERATOR_HPP
 
 #include "LzTools.hpp"
+#include "ToChars.hpp"
+
+#include <memory>
 
 #ifdef LZ_STANDALONE
 #ifdef LZ_HAS_FORMAT
 #include <format>
-#else
-#include <sstream>
 #endif // LZ_HAS_FORMAT
 #else
+#include <fmt/compile.h>
 #include <fmt/ostream.h>
 #endif // LZ_STANDALONE
 
 namespace lz {
 namespace internal {
-#if defined(LZ_STANDALONE) && (!defined(LZ_HAS_FORMAT))
-template<class T>
-std::string toStringSpecialized(std::true_type /* isArithmetic */, const T value) {
-    using lz::internal::to_string;
-    using std::to_string;
-    return to_string(value);
-}
-
-template<class T>
-std::string toStringSpecialized(std::false_type /* isArithmetic */, const T& value) {
-    std::ostringstream oss;
-    oss << value;
-    return oss.str();
-}
-#endif // defined(LZ_STANDALONE) && (!defined(LZ_HAS_FORMAT))
+/**
+ * The delimiter and format of a `Join`. It is shared by the view and all of its iterators, so that copying an iterator doesn't
+ * copy the strings. `fmt` is unused if neither {fmt} nor std::format is available, but is always declared so that the layout
+ * doesn't depend on `LZ_STANDALONE`. Whether `fmt` is `"{}"` is determined once, so that the values can be formatted using a
+ * compiled format string without comparing `fmt` for every value.
+ */
+struct JoinFormat {
+    std::string delimiter;
+    std::string fmt;
+    bool isDefaultFormat;
+
+    JoinFormat(std::string delim, std::string format) :
+        delimiter(std::move(delim)),
+        fmt(std::move(format)),
+        isDefaultFormat(fmt == "{}") {
+    }
+};
 
 template<LZ_CONCEPT_ITERATOR Iterator>
 class JoinIterator {
     using IterTraits = std::iterator_traits<Iterator>;
     using ContainerType = typename IterTraits::value_type;
-    using IsContainerTypeString = std::is_same<ContainerType, std::string>;
+    // Strings that live in the underlying sequence can be returned as is
+    using IsContainerTypeString =
+        std::integral_constant<bool, std::is_same<ContainerType, std::string>::value &&
+                                         std::is_lvalue_reference<typename IterTraits::reference>::value>;
 
 public:
     using value_type = std::string;
     using iterator_category = typename IterTraits::iterator_category;
     using difference_type = typename IterTraits::difference_type;
-    using reference = Conditional<std::is_same<std::string, ContainerType>::value, typename IterTraits::reference, std::string>;
+    using reference = StringView;
     using pointer = FakePointerProxy<reference>;
 
 private:
     Iterator _iterator{};
-    mutable std::string _delimiter{};
-#if defined(LZ_HAS_FORMAT) || !defined(LZ_STANDALONE)
-    std::string _fmt{};
-#endif
-    mutable bool _isIteratorTurn{ true };
+    std::shared_ptr<const JoinFormat> _format{};
+    // The last formatted value. Its capacity is reused, so that most values are formatted without allocating
+    mutable std::string _buffer{};
+    bool _isIteratorTurn{ true };
 
-    reference deref(std::false_type /* isSameContainerTypeString */) const {
-        if (_isIteratorTurn) {
+    void format(const std::string& value) const {
+        _buffer = value;
+    }
+
+    template<class T>
+    void format(const T& value) const {
+        _buffer.clear();
 #ifdef LZ_STANDALONE
 #ifdef LZ_HAS_FORMAT
-            return std::format(_fmt.c_str(), *_iterator);
+        std::vformat_to(std::back_inserter(_buffer), _format->fmt, std::make_format_args(value));
 #else
-            return toStringSpecialized(std::is_arithmetic<ContainerType>(), *_iterator);
+        appendValue(_buffer, value);
 #endif // LZ_HAS_FORMAT
 #else
-            return fmt::format(_fmt.c_str(), *_iterator);
-#endif // LZ_STANDALONE
+        if (_format->isDefaultFormat) {
+            fmt::format_to(std::back_inserter(_buffer), FMT_COMPILE("{}"), value);
         }
-        return _delimiter;
+        else {
+            fmt::vformat_to(std::back_inserter(_buffer), fmt::string_view(_format->fmt), fmt::make_format_args(value));
+        }
+#endif // LZ_STANDALONE
     }
 
-    LZ_CONSTEXPR_CXX_20 reference deref(std::true_type /* isSameContainerTypeString */) const {
-        if (_isIteratorTurn) {
-            return *_iterator;
-        }
-        return _delimiter;
+    reference element(const Iterator& iterator, std::false_type /* isSameContainerTypeString */) const {
+        format(*iterator);
+        return reference(_buffer.data(), _buffer.size());
     }
 
-    LZ_CONSTEXPR_CXX_20 reference indexOperator(std::true_type /* isSameContainerTypeString */,
-                                                const difference_type offset) const {
-        // If we use *(*this + offset) when a delimiter must be returned, then we get a segfault because the operator+ returns a
-        // copy of the delimiter
-        if (_isIteratorTurn && isEven(offset)) {
-            return *(*this + offset);
-        }
-        return _delimiter;
+    static reference element(const Iterator& iterator, std::true_type /* isSameContainerTypeString */) {
+        const std::string& value = *iterator;
+        return reference(value.data(), value.size());
     }
 
-    reference indexOperator(std::false_type /* isSameContainerTypeString */, const difference_type offset) const {
-        return *(*this + offset);
+    // The value is formatted into the buffer of this iterator, so that it stays valid after a temporary iterator is destroyed
+    reference deref(const Iterator& iterator, const bool isIteratorTurn) const {
+        if (isIteratorTurn) {
+            return element(iterator, IsContainerTypeString());
+        }
+        return reference(_format->delimiter.data(), _format->delimiter.size());
     }
 
 public:
-#if defined(LZ_HAS_FORMAT) || !defined(LZ_STANDALONE)
-    LZ_CONSTEXPR_CXX_20
-    JoinIterator(Iterator iterator, std::string delimiter, std::string fmt, const bool isIteratorTurn) :
-        _iterator(std::move(iterator)),
-        _delimiter(std::move(delimiter)),
-        _fmt(std::move(fmt)),
-        _isIteratorTurn(isIteratorTurn) {
-    }
-#else
-    LZ_CONSTEXPR_CXX_20
-    JoinIterator(Iterator iterator, std::string delimiter, const bool isIteratorTurn) :
+    JoinIterator(Iterator iterator, std::shared_ptr<const JoinFormat> format, const bool isIteratorTurn) :
         _iterator(std::move(iterator)),
-        _delimiter(std::move(delimiter)),
+        _format(std::move(format)),
         _isIteratorTurn(isIteratorTurn) {
     }
-#endif // has format
 
     JoinIterator() = default;
 
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator*() const {
-        return deref(IsContainerTypeString());
+    LZ_NODISCARD reference operator*() const {
+        return deref(_iterator, _isIteratorTurn);
     }
 
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 pointer operator->() const {
+    LZ_NODISCARD pointer operator->() const {
         return FakePointerProxy<decltype(**this)>(**this);
     }
 
@@ -126,7 +126,7 @@ public:
         return *this;
     }
 
-    LZ_CONSTEXPR_CXX_20 JoinIterator& operator++(int) {
+    LZ_CONSTEXPR_CXX_20 JoinIterator operator++(int) {
         JoinIterator tmp(*this);
         ++*this;
         return tmp;
@@ -165,13 +165,14 @@ public:
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend difference_type operator-(const JoinIterator& a, const JoinIterator& b) {
-        LZ_ASSERT(a._delimiter == b._delimiter, "incompatible iterator types: found different delimiters");
+        LZ_ASSERT(a._format == b._format, "incompatible iterator types: found different delimiters");
         // distance * 2 for delimiter, - 1 for removing last delimiter
         return (a._iterator - b._iterator) * 2 - 1;
     }
 
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator[](const difference_type offset) const {
-        return indexOperator(IsContainerTypeString(), offset);
+    LZ_NODISCARD reference operator[](const difference_type offset) const {
+        const JoinIterator tmp = *this + offset;
+        return deref(tmp._iterator, tmp._isIteratorTurn);
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 JoinIterator operator-(const difference_type offset) const {
@@ -181,7 +182,7 @@ public:
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator==(const JoinIterator& a, const JoinIterator& b) {
-        LZ_ASSERT(a._delimiter == b._delimiter, "incompatible iterator types: found different delimiters");
+        LZ_ASSERT(a._format == b._format, "incompatible iterator types: found different delimiters");
         return a._iterator == b._iterator;
     }
 
@@ -190,7 +191,7 @@ public:
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator<(const JoinIterator& a, const JoinIterator& b) {
-        LZ_ASSERT(a._delimiter == b._delimiter, "incompatible iterator types: found different delimiters");
+        LZ_ASSERT(a._format == b._format, "incompatible iterator types: found different delimiters");
         return b - a > 0;
     }
 
@@ -205,6 +206,12 @@ public:
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator>=(const JoinIterator& a, const JoinIterator& b) {
         return !(a < b); // NOLINT
     }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend SizeHint sizeHint(const JoinIterator& begin, const JoinIterator& end) {
+        // n elements are joined by n - 1 delimiters
+        const auto hint = getSizeHint(begin._iterator, end._iterator);
+        return { hint.lower == 0 ? 0 : hint.lower * 2 - 1, mulSaturated(hint.upper, 2) };
+    }
 };
 } // namespace internal
 } // namespace lz
@@ -5,10 +5,96 @@
 
 #include "FunctionContainer.hpp"
 #include "LzTools.hpp"
+#include "ParallelAlgorithms.hpp"
 
 namespace lz {
 namespace internal {
 #ifdef LZ_HAS_EXECUTION
+/**
+ * Parallel sort-merge join of a random access sequence A with a sorted random access sequence B. A is split into blocks, every
+ * worker looks up the matching range in B of each element of its own block, which gives a result count per block. An exclusive
+ * prefix sum over these counts gives the output offset of every block, after which every worker writes the results of its block
+ * to its own output segment. No cursor or lock is shared between the workers.
+ */
+template<class Execution>
+class JoinWherePlan {
+    Execution _execution{};
+    std::size_t _length{};
+    std::size_t _blocks{};
+    std::vector<std::size_t> _lowerB;
+    std::vector<std::size_t> _countB;
+    std::vector<std::size_t> _offsets;
+
+public:
+    template<class IterA, class IterB, class SelectorA, class SelectorB>
+    JoinWherePlan(Execution execution, const IterA& beginA, const IterA& endA, const IterB& beginB, const IterB& endB,
+                  SelectorA& selectorA, SelectorB& selectorB) :
+        _execution(execution),
+        _length(static_cast<std::size_t>(endA - beginA)),
+        _blocks(blockCount(threadCount(execution), _length, 512, 8)),
+        _lowerB(_length),
+        _countB(_length),
+        _offsets(_blocks + 1) {
+        using KeyA = Decay<decltype(selectorA(*beginA))>;
+        using ValueTypeB = ValueType<IterB>;
+        using DiffA = DiffType<IterA>;
+
+        parallelForEachBlock(_execution, _length, _blocks,
+                             [&, this](const std::size_t block, const std::size_t first, const std::size_t last) {
+                                 std::size_t count = 0;
+                                 for (std::size_t i = first; i < last; ++i) {
+                                     const KeyA key = selectorA(beginA[static_cast<DiffA>(i)]);
+                                     const auto range = std::equal_range(
+                                         beginB, endB, key,
+                                         Compare<SelectorB, ValueTypeB, KeyA>{ selectorB });
+                                     _lowerB[i] = static_cast<std::size_t>(range.first - beginB);
+                                     _countB[i] = static_cast<std::size_t>(range.second - range.first);
+                                     count += _countB[i];
+                                 }
+                                 _offsets[block + 1] = count;
+                             });
+        std::partial_sum(_offsets.begin(), _offsets.end(), _offsets.begin());
+    }
+
+    // Compares keys of A with elements of B in both directions, for std::equal_range
+    template<class SelectorB, class ValueTypeB, class KeyA>
+    struct Compare {
+        SelectorB& selectorB;
+
+        bool operator()(const ValueTypeB& b, const KeyA& key) const {
+            return selectorB(b) < key;
+        }
+
+        bool operator()(const KeyA& key, const ValueTypeB& b) const {
+            return key < selectorB(b);
+        }
+    };
+
+    // The total amount of results
+    LZ_NODISCARD std::size_t size() const noexcept {
+        return _offsets.back();
+    }
+
+    // Writes resultSelector(a, b) of every matching pair to [output, output + size()), in the same order as the join iterator
+    template<class IterA, class IterB, class ResultSelector, class OutputIterator>
+    void scatter(const IterA& beginA, const IterB& beginB, ResultSelector& resultSelector, const OutputIterator& output) {
+        using DiffA = DiffType<IterA>;
+        using DiffB = DiffType<IterB>;
+        using OutDiff = DiffType<OutputIterator>;
+        parallelForEachBlock(_execution, _length, _blocks,
+                             [&, this](const std::size_t block, const std::size_t first, const std::size_t last) {
+                                 auto out = output + static_cast<OutDiff>(_offsets[block]);
+                                 for (std::size_t i = first; i < last; ++i) {
+                                     const auto b = beginB + static_cast<DiffB>(_lowerB[i]);
+                                     for (std::size_t j = 0; j < _countB[i]; ++j) {
+                                         *out = resultSelector(beginA[static_cast<DiffA>(i)], b[static_cast<DiffB>(j)]);
+                                         ++out;
+                                     }
+                                 }
+                             });
+    }
+};
+
 template<class IterA, class IterB, class SelectorA, class SelectorB, class ResultSelector, class Execution>
 #else
 
@@ -28,6 +114,8 @@ private:
     IterB _iterB{};
     IterB _beginB{};
     IterB _endB{};
+    IterB _lowerB{};
+    IterB _belowB{};
 #ifdef LZ_HAS_EXECUTION
     Execution _exec{};
 #endif // LZ_HAS_EXECUTION
@@ -35,47 +123,68 @@ private:
     mutable FunctionContainer<SelectorB> _selectorB{};
     mutable FunctionContainer<ResultSelector> _resultSelector{};
 
+    // Merge join: `_lowerB` is the lower bound in B of the previous key of A, and `_belowB` the element before it (or `_endB`).
+    // As long as the keys of A are ascending, both cursors only move forward. If a key is smaller than the previous one, the
+    // search is restarted from the beginning of B
+    LZ_CONSTEXPR_CXX_20 void mergeFind() {
+        auto less = [this](const ValueTypeB& b, const SelectorARetVal& val) {
+            return _selectorB(b) < val;
+        };
+        for (; _iterA != _endA; ++_iterA) {
+            auto&& key = _selectorA(*_iterA);
+            if (_belowB != _endB && !(_selectorB(*_belowB) < key)) { // NOLINT
+                _lowerB = _beginB;
+                _belowB = _endB;
+            }
+            _lowerB = gallopLowerBound(std::move(_lowerB), _endB, key, less, _belowB);
+            if (_lowerB != _endB && !(key < _selectorB(*_lowerB))) { // NOLINT
+                _iterB = _lowerB;
+                return;
+            }
+        }
+    }
+
+    LZ_CONSTEXPR_CXX_20 void mergeNext() {
+        // All elements of B with the same key are adjacent, so the duplicates are emitted by simply advancing _iterB. The next
+        // element of A starts at the same lower bound, so that duplicate keys in A are joined with all of them as well
+        ++_iterB;
+        if (_iterB != _endB && !(_selectorA(*_iterA) < _selectorB(*_iterB))) { // NOLINT
+            return;
+        }
+        ++_iterA;
+        mergeFind();
+    }
+
     LZ_CONSTEXPR_CXX_20 void findNext() {
 #ifdef LZ_HAS_EXECUTION
-        if constexpr (checkForwardAndPolicies<Execution, IterA>()) {
-            std::mutex mutex;
-            _iterA = std::find_if(_exec, _iterA, _endA, [this, &mutex](const ValueType<IterA>& a) {
-                std::lock_guard guard(mutex);
-                auto&& toFind = _selectorA(a);
-                _iterB =
-                    std::lower_bound(std::move(_iterB), _endB, toFind,
-                                     [this](const ValueTypeB& b, const SelectorARetVal& val) { return _selectorB(b) < val; });
-                if (_iterB != _endB && !(toFind < _selectorB(*_iterB))) { // NOLINT
-                    return true;
+        if constexpr (!checkForwardAndPolicies<Execution, IterA>()) {
+            // First check whether the current element of A has more matches. After that, every element of A is looked up
+            // independently in B, so that the threads don't share a cursor
+            if (_iterB != _beginB) {
+                if (_iterB != _endB && !(_selectorA(*_iterA) < _selectorB(*_iterB))) { // NOLINT
+                    return;
                 }
+                ++_iterA;
                 _iterB = _beginB;
-                return false;
-            });
-        }
-        else {
-            _iterA = std::find_if(_iterA, _endA, [this](const ValueType<IterA>& a) {
+            }
+            _iterA = internal::findIf(_exec, _iterA, _endA, [this](const ValueType<IterA>& a) {
                 auto&& toFind = _selectorA(a);
-                _iterB =
-                    std::lower_bound(std::move(_iterB), _endB, toFind,
+                const IterB pos =
+                    std::lower_bound(_beginB, _endB, toFind,
                                      [this](const ValueTypeB& b, const SelectorARetVal& val) { return _selectorB(b) < val; });
-                if (_iterB != _endB && !(toFind < _selectorB(*_iterB))) { // NOLINT
-                    return true;
-                }
-                _iterB = _beginB;
-                return false;
+                return pos != _endB && !(toFind < _selectorB(*pos)); // NOLINT
             });
+            if (_iterA != _endA) {
+                auto&& toFind = _selectorA(*_iterA);
+                _iterB = std::lower_bound(_beginB, _endB, toFind,
+                                          [this](const ValueTypeB& b, const SelectorARetVal& val) { return _selectorB(b) < val; });
+            }
+        }
+        else {
+            mergeFind();
         }
 #else
-        _iterA = std::find_if(_iterA, _endA, [this](const ValueType<IterA>& a) {
-            auto&& toFind = _selectorA(a);
-            _iterB = std::lower_bound(std::move(_iterB), _endB, toFind,
-                                      [this](const ValueTypeB& b, const SelectorARetVal& val) { return _selectorB(b) < val; });
-            if (_iterB != _endB && !(toFind < _selectorB(*_iterB))) { // NOLINT
-                return true;
-            }
-            _iterB = _beginB;
-            return false;
-        });
+        mergeFind();
 #endif // LZ_HAS_EXECUTION
     }
 
@@ -99,6 +208,8 @@ public:
         _iterB(iterB),
         _beginB(iterB == endB ? endB : std::move(iterB)),
         _endB(std::move(endB)),
+        _lowerB(_beginB),
+        _belowB(_endB),
 #ifdef LZ_HAS_EXECUTION
         _exec(execution),
 #endif // LZ_HAS_EXECUTION
@@ -122,8 +233,17 @@ public:
     }
 
     LZ_CONSTEXPR_CXX_20 JoinWhereIterator& operator++() {
-        ++_iterB;
-        findNext();
+#ifdef LZ_HAS_EXECUTION
+        if constexpr (!checkForwardAndPolicies<Execution, IterA>()) {
+            ++_iterB;
+            findNext();
+        }
+        else {
+            mergeNext();
+        }
+#else
+        mergeNext();
+#endif // LZ_HAS_EXECUTION
         return *this;
     }
 
@@ -140,8 +260,38 @@ public:
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator!=(const JoinWhereIterator& a, const JoinWhereIterator& b) {
         return !(a == b); // NOLINT
     }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend SizeHint sizeHint(const JoinWhereIterator& begin, const JoinWhereIterator& end) {
+        const auto upper = mulSaturated(getSizeHint(begin._iterA, end._iterA).upper, getSizeHint(begin._beginB, begin._endB).upper);
+        return { begin != end ? 1u : 0u, upper };
+    }
+
+#ifdef LZ_HAS_EXECUTION
+    LZ_NODISCARD friend JoinWherePlan<Execution> compact(const JoinWhereIterator& begin, const JoinWhereIterator& end) {
+        return compact(begin, end, begin._exec);
+    }
+
+    template<class Policy>
+    LZ_NODISCARD friend JoinWherePlan<Policy>
+    compact(const JoinWhereIterator& begin, const JoinWhereIterator& end, const Policy execution) {
+        return { execution, begin._iterA, end._iterA, begin._beginB, begin._endB, begin._selectorA, begin._selectorB };
+    }
+
+    template<class Policy, class OutputIterator>
+    friend void scatter(const JoinWhereIterator& begin, JoinWherePlan<Policy>& plan, const OutputIterator& output) {
+        plan.scatter(begin._iterA, begin._beginB, begin._resultSelector, output);
+    }
+#endif // LZ_HAS_EXECUTION
 };
 
+#ifdef LZ_HAS_EXECUTION
+// With a parallel policy, a join of random access sequences is collected using a parallel sort-merge join
+template<class IterA, class IterB, class SelectorA, class SelectorB, class ResultSelector, class Execution>
+struct IsCompactable<JoinWhereIterator<IterA, IterB, SelectorA, SelectorB, ResultSelector, Execution>>
+    : std::integral_constant<bool, !IsSequencedPolicyV<Execution> && IsRandomAccess<IterA>::value &&
+                                       IsRandomAccess<IterB>::value> {};
+#endif // LZ_HAS_EXECUTION
+
 } // namespace internal
 } // namespace lz
 #endif // LZ_LEFT_JOIN_ITERATOR_HPP
@@ -0,0 +1,96 @@
+#pragma once
+
+#ifndef LZ_LINES_ITERATOR_HPP
+#define LZ_LINES_ITERATOR_HPP
+
+#include "CharSearch.hpp"
+#include "LzTools.hpp"
+
+#include <string>
+
+namespace lz {
+namespace internal {
+/**
+ * Splits a character buffer into lines, without copying. Line feeds are searched using `findDelimiter`, so that the buffer is
+ * classified 64 characters at a time. A carriage return directly before a line feed is not part of the line, and a last line
+ * without a line feed is returned as well.
+ */
+template<class SubString>
+class LinesIterator {
+    const char* _data{ nullptr };
+    std::size_t _size{};
+    std::size_t _currentPos{}, _last{};
+    DelimiterBlock _block{};
+
+    void findLineFeed() {
+        static constexpr char lineFeed = '\n';
+        _last = findDelimiter(_data, _size, _currentPos, &lineFeed, 1, _block);
+    }
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = SubString;
+    using reference = SubString;
+    using difference_type = std::ptrdiff_t;
+    using pointer = FakePointerProxy<reference>;
+
+    LinesIterator(const std::size_t startingPosition, const char* data, const std::size_t size) :
+        _data(data),
+        _size(size),
+        _currentPos(startingPosition),
+        _last(std::string::npos) {
+        if (startingPosition == 0 && size != 0) {
+            findLineFeed();
+        }
+    }
+
+    LinesIterator() = default;
+
+    value_type operator*() const {
+        std::size_t end = _size;
+        if (_last != std::string::npos) {
+            end = _last != _currentPos && _data[_last - 1] == '\r' ? _last - 1 : _last;
+        }
+        return SubString(_data + _currentPos, end - _currentPos);
+    }
+
+    pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    constexpr friend bool operator!=(const LinesIterator& a, const LinesIterator& b) noexcept {
+        return a._currentPos != b._currentPos;
+    }
+
+    constexpr friend bool operator==(const LinesIterator& a, const LinesIterator& b) noexcept {
+        return !(a != b); // NOLINT
+    }
+
+    LZ_NODISCARD constexpr friend SizeHint sizeHint(const LinesIterator& begin, const LinesIterator& end) noexcept {
+        // Every line consumes at least one character, either of itself or of the line feed
+        return begin._currentPos < end._currentPos ? SizeHint(1, end._currentPos - begin._currentPos) : SizeHint(0, 0);
+    }
+
+    LinesIterator& operator++() noexcept {
+        if (_last == std::string::npos || _last == _size - 1) {
+            // The last line, with or without a line feed
+            _currentPos = _size;
+            _last = std::string::npos;
+        }
+        else {
+            _currentPos = _last + 1;
+            findLineFeed();
+        }
+        return *this;
+    }
+
+    LinesIterator operator++(int) noexcept {
+        LinesIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_LINES_ITERATOR_HPP
@@ -3,7 +3,9 @@
 #ifndef LZ_LZ_TOOLS_HPP
 #    define LZ_LZ_TOOLS_HPP
 
+#    include <algorithm>
 #    include <iterator>
+#    include <limits>
 #    include <tuple>
 
 #    if defined(__has_include)
@@ -134,6 +136,8 @@ concept Arithmetic = std::is_arithmetic_v<I>;
 #    endif // NDEBUG
 
 namespace lz {
+class ThreadPoolExecutor;
+
 namespace internal {
 
 #    ifdef NDEBUG
@@ -168,6 +172,18 @@ class FlattenIterator;
 template<class Iterator>
 class ExcludeIterator;
 
+template<LZ_CONCEPT_ITERATOR Iterator, class Function>
+class MapIterator;
+
+template<LZ_CONCEPT_ITERATOR Iterator, LZ_CONCEPT_INTEGRAL Arithmetic>
+class EnumerateIterator;
+
+template<LZ_CONCEPT_ITERATOR... Iterators>
+class ZipIterator;
+
+template<LZ_CONCEPT_ITERATOR... Iterators>
+class ConcatenateIterator;
+
 template<class Iterable>
 constexpr auto begin(Iterable&& c) noexcept -> decltype(std::forward<Iterable>(c).begin()) {
     return std::forward<Iterable>(c).begin();
@@ -274,9 +290,13 @@ constexpr bool IsSequencedPolicyV = IsSequencedPolicy<T>::value;
 template<class T>
 constexpr bool IsForwardOrStrongerV = IsForwardOrStronger<T>::value;
 
+template<class T>
+struct IsThreadPoolExecutor : std::is_same<T, ThreadPoolExecutor> {};
+
 template<class Execution, class Iterator>
 constexpr bool checkForwardAndPolicies() {
-    static_assert(std::is_execution_policy_v<Execution>, "Execution must be of type std::execution::*...");
+    static_assert(std::is_execution_policy_v<Execution> || IsThreadPoolExecutor<Execution>::value,
+                  "Execution must be of type std::execution::* or lz::ThreadPoolExecutor");
     constexpr bool isSequenced = IsSequencedPolicyV<Execution>;
     if constexpr (!isSequenced) {
         static_assert(IsForwardOrStrongerV<Iterator>,
@@ -332,6 +352,24 @@ struct IsBidirectional : std::is_convertible<IterCat<Iterator>, std::bidirection
 template<class Iterator>
 struct IsForward : std::is_convertible<IterCat<Iterator>, std::forward_iterator_tag> {};
 
+template<class Iterator>
+struct IsRandomAccess : std::is_convertible<IterCat<Iterator>, std::random_access_iterator_tag> {};
+
+/**
+ * Checks whether the length of [begin, end) can be computed in constant time, using `getIterLength`. This is true for random
+ * access iterators, and for iterators that specialize this trait because they can derive their length from their underlying
+ * iterator(s) (e.g. map, zip, concatenate), even if they are not random access themselves.
+ */
+template<class Iterator>
+struct IsSized : IsRandomAccess<Iterator> {};
+
+template<class... Iterators>
+struct IsAllSized : std::true_type {};
+
+template<class Iterator, class... Iterators>
+struct IsAllSized<Iterator, Iterators...>
+    : std::integral_constant<bool, IsSized<Iterator>::value && IsAllSized<Iterators...>::value> {};
+
 template<LZ_CONCEPT_INTEGRAL Arithmetic>
 inline constexpr bool isEven(const Arithmetic value) noexcept {
     return (value % 2) == 0;
@@ -379,6 +417,22 @@ template<LZ_CONCEPT_ITERATOR Iterator>
 LZ_NODISCARD LZ_CONSTEXPR_CXX_20 typename internal::ExcludeIterator<Iterator>::difference_type
 distance(const internal::ExcludeIterator<Iterator>&, const internal::ExcludeIterator<Iterator>&);
 
+template<LZ_CONCEPT_ITERATOR Iterator, class Function>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 typename internal::MapIterator<Iterator, Function>::difference_type
+distance(const internal::MapIterator<Iterator, Function>&, const internal::MapIterator<Iterator, Function>&);
+
+template<LZ_CONCEPT_ITERATOR Iterator, LZ_CONCEPT_INTEGRAL Arithmetic>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 typename internal::EnumerateIterator<Iterator, Arithmetic>::difference_type
+distance(const internal::EnumerateIterator<Iterator, Arithmetic>&, const internal::EnumerateIterator<Iterator, Arithmetic>&);
+
+template<LZ_CONCEPT_ITERATOR... Iterators>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 typename internal::ZipIterator<Iterators...>::difference_type
+distance(const internal::ZipIterator<Iterators...>&, const internal::ZipIterator<Iterators...>&);
+
+template<LZ_CONCEPT_ITERATOR... Iterators>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 typename internal::ConcatenateIterator<Iterators...>::difference_type
+distance(const internal::ConcatenateIterator<Iterators...>&, const internal::ConcatenateIterator<Iterators...>&);
+
 template<LZ_CONCEPT_ITERATOR... Iterators>
 LZ_NODISCARD LZ_CONSTEXPR_CXX_20 internal::CartesianProductIterator<Iterators...>
 next(const internal::CartesianProductIterator<Iterators...>&,
@@ -412,6 +466,186 @@ DiffType<Iterator> getIterLength(Iterator begin, Iterator end) {
     using lz::distance;
     return distance(std::move(begin), std::move(end));
 }
+
+/**
+ * Pushes every element in [begin, end) to `func`, until `func` returns `true`. Iterators that can drive their elements in a
+ * tighter loop than `operator++` + `operator!=` provide their own `forEachUntil` as a friend, which is picked up by ADL. Always
+ * call this function unqualified.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param func A function that takes a `reference` of `Iterator` and returns `true` to stop the iteration.
+ * @return `true` if `func` stopped the iteration, `false` if the end of the sequence was reached.
+ */
+template<class Iterator, class UnaryFunc>
+LZ_CONSTEXPR_CXX_20 bool forEachUntil(Iterator begin, Iterator end, UnaryFunc&& func) {
+    for (; begin != end; ++begin) {
+        if (func(*begin)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * The lower and upper bound of the amount of elements of a sequence, like Rust's `Iterator::size_hint`. If the upper bound is
+ * not known, it is equal to `SizeHint::unbounded()`.
+ */
+struct SizeHint {
+    std::size_t lower{};
+    std::size_t upper{ unbounded() };
+
+    constexpr SizeHint() = default;
+
+    constexpr SizeHint(const std::size_t lower, const std::size_t upper) noexcept : lower(lower), upper(upper) {
+    }
+
+    static constexpr std::size_t unbounded() noexcept {
+        return (std::numeric_limits<std::size_t>::max)();
+    }
+
+    constexpr bool hasUpper() const noexcept {
+        return upper != unbounded();
+    }
+
+    constexpr bool isExact() const noexcept {
+        return lower == upper;
+    }
+};
+
+constexpr std::size_t addSaturated(const std::size_t a, const std::size_t b) noexcept {
+    return a > SizeHint::unbounded() - b ? SizeHint::unbounded() : a + b;
+}
+
+constexpr std::size_t mulSaturated(const std::size_t a, const std::size_t b) noexcept {
+    return a != 0 && b > SizeHint::unbounded() / a ? SizeHint::unbounded() : a * b;
+}
+
+/**
+ * Default size hint for iterators that do not know their length. Iterators that can derive a tighter bound from their
+ * underlying iterator(s) provide their own `sizeHint` as a friend, which is picked up by ADL. Use `getSizeHint` instead of
+ * calling this directly.
+ */
+template<class Iterator>
+LZ_CONSTEXPR_CXX_20 SizeHint sizeHint(const Iterator& begin, const Iterator& end) {
+    return { begin != end ? 1u : 0u, SizeHint::unbounded() };
+}
+
+template<class Iterator>
+SizeHint getSizeHint(const Iterator& begin, const Iterator& end, std::true_type /* isSized */) {
+    const auto size = static_cast<std::size_t>(getIterLength(begin, end));
+    return { size, size };
+}
+
+template<class Iterator>
+LZ_CONSTEXPR_CXX_20 SizeHint getSizeHint(const Iterator& begin, const Iterator& end, std::false_type /* isSized */) {
+    return sizeHint(begin, end);
+}
+
+/**
+ * Gets the lower and upper bound of the length of [begin, end) without iterating over it. Exact if `Iterator` is sized.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @return The size hint of the sequence.
+ */
+template<class Iterator>
+LZ_CONSTEXPR_CXX_20 SizeHint getSizeHint(const Iterator& begin, const Iterator& end) {
+    return getSizeHint(begin, end, IsSized<Iterator>());
+}
+
+template<class Iterator, class T, class Less>
+LZ_CONSTEXPR_CXX_20 Iterator gallopLowerBound(const Iterator first, const Iterator& last, const T& value, Less& less,
+                                              Iterator& below, std::random_access_iterator_tag) {
+    using Diff = DiffType<Iterator>;
+    const Diff remaining = last - first;
+    Diff low = 0;
+    Diff high = 1;
+    while (high <= remaining && less(first[high - 1], value)) {
+        low = high;
+        high *= 2;
+    }
+    const Iterator result = std::lower_bound(first + low, first + (high > remaining ? remaining : high), value, less);
+    if (result != first) {
+        below = result - 1;
+    }
+    return result;
+}
+
+template<class Iterator, class T, class Less>
+LZ_CONSTEXPR_CXX_20 Iterator
+gallopLowerBound(Iterator first, const Iterator& last, const T& value, Less& less, Iterator& below, std::forward_iterator_tag) {
+    for (; first != last && less(*first, value); ++first) {
+        below = first;
+    }
+    return first;
+}
+
+/**
+ * Finds the first element in the sorted sequence [first, last) that is not less than `value`, by probing 1, 2, 4, 8... elements
+ * ahead and binary searching the last interval. This costs O(log d) comparisons, where d is the distance to the result, which
+ * makes it suitable for cursors that only move forward. Non random access sequences are traversed linearly.
+ * @param less Comparer with parameters `(element, value)`.
+ * @param below Set to the element before the result, if the result is not `first`.
+ * @return The first element that is not less than `value`.
+ */
+template<class Iterator, class T, class Less>
+LZ_CONSTEXPR_CXX_20 Iterator gallopLowerBound(Iterator first, const Iterator& last, const T& value, Less& less, Iterator& below) {
+    return gallopLowerBound(std::move(first), last, value, less, below, IterCat<Iterator>());
+}
+
+template<class Value, class OutputIterator, class T>
+LZ_CONSTEXPR_CXX_20 auto assignOutput(OutputIterator& output, T&& value, int)
+    -> decltype(void(*output = std::forward<T>(value))) {
+    *output = std::forward<T>(value);
+}
+
+template<class Value, class T>
+LZ_CONSTEXPR_CXX_20 Value toValue(T&& value, std::true_type /* isConstructible */) {
+    return Value(std::forward<T>(value));
+}
+
+// Strings that cannot be converted at all (like a `fmt::string_view` to a `std::string`) are copied from their characters
+template<class Value, class T>
+LZ_CONSTEXPR_CXX_20 Value toValue(T&& value, std::false_type /* isConstructible */) {
+    return Value(value.data(), value.size());
+}
+
+// The value cannot be assigned as is (like a `std::string_view` to a `std::string`), so it is explicitly converted first
+template<class Value, class OutputIterator, class T>
+LZ_CONSTEXPR_CXX_20 void assignOutput(OutputIterator& output, T&& value, long) {
+    *output = toValue<Value>(std::forward<T>(value), std::is_constructible<Value, T>());
+}
+
+template<class Container, class T>
+LZ_CONSTEXPR_CXX_20 void emplaceValue(Container& container, T&& value, std::true_type /* isConstructible */) {
+    container.emplace_back(std::forward<T>(value));
+}
+
+template<class Container, class T>
+LZ_CONSTEXPR_CXX_20 void emplaceValue(Container& container, T&& value, std::false_type /* isConstructible */) {
+    container.push_back(toValue<typename Container::value_type>(std::forward<T>(value), std::false_type()));
+}
+
+template<class Iterator, class OutputIterator>
+LZ_CONSTEXPR_CXX_20 OutputIterator copy(Iterator begin, Iterator end, OutputIterator output) {
+    using Ref = RefType<Iterator>;
+    forEachUntil(std::move(begin), std::move(end), [&output](Ref value) {
+        assignOutput<ValueType<Iterator>>(output, std::forward<Ref>(value), 0);
+        ++output;
+        return false;
+    });
+    return output;
+}
+
+template<class Iterator, class OutputIterator, class UnaryFunc>
+LZ_CONSTEXPR_CXX_20 OutputIterator transform(Iterator begin, Iterator end, OutputIterator output, UnaryFunc func) {
+    using Ref = RefType<Iterator>;
+    forEachUntil(std::move(begin), std::move(end), [&output, &func](Ref value) {
+        *output = func(std::forward<Ref>(value));
+        ++output;
+        return false;
+    });
+    return output;
+}
 } // namespace internal
 } // namespace lz
 
@@ -82,7 +82,7 @@ public:
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend difference_type operator-(const MapIterator& a, const MapIterator& b) {
-        return a._iterator - b._iterator;
+        return getIterLength(b._iterator, a._iterator);
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator[](const difference_type offset) const {
@@ -112,8 +112,35 @@ public:
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator>=(const MapIterator& a, const MapIterator& b) {
         return !(a < b); // NOLINT
     }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend SizeHint sizeHint(const MapIterator& begin, const MapIterator& end) {
+        return getSizeHint(begin._iterator, end._iterator);
+    }
+
+    template<class UnaryFunc>
+    LZ_CONSTEXPR_CXX_20 friend bool forEachUntil(MapIterator begin, MapIterator end, UnaryFunc&& func) {
+        using Ref = typename IterTraits::reference;
+        return forEachUntil(std::move(begin._iterator), std::move(end._iterator), [&begin, &func](Ref value) {
+            return func(begin._function(std::forward<Ref>(value)));
+        });
+    }
 };
+
+template<class Iterator, class Function>
+struct IsSized<MapIterator<Iterator, Function>> : IsSized<Iterator> {};
 } // namespace internal
+
+/**
+ * Gets the distance between begin and end. If the underlying iterator type is sized, this is O(1).
+ * @param begin Beginning of the sequence.
+ * @param end Ending of the sequence.
+ * @return The length of the sequence.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class Function>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 typename internal::MapIterator<Iterator, Function>::difference_type
+distance(const internal::MapIterator<Iterator, Function>& begin, const internal::MapIterator<Iterator, Function>& end) {
+    return end - begin;
+}
 } // namespace lz
 
 #endif
\ No newline at end of file
@@ -0,0 +1,83 @@
+#pragma once
+
+#ifndef LZ_OUTPUT_SINK_HPP
+#define LZ_OUTPUT_SINK_HPP
+
+#include "LzTools.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <ostream>
+#include <system_error>
+#include <type_traits>
+
+namespace lz {
+namespace internal {
+template<class OutputIterator>
+class IteratorSink {
+    OutputIterator _iterator;
+
+public:
+    explicit IteratorSink(OutputIterator iterator) : _iterator(std::move(iterator)) {
+    }
+
+    void write(const char* data, const std::size_t count) {
+        _iterator = std::copy(data, data + count, _iterator);
+    }
+
+    OutputIterator get() const {
+        return _iterator;
+    }
+};
+
+class OstreamSink {
+    std::ostream* _stream{ nullptr };
+
+public:
+    explicit OstreamSink(std::ostream& stream) noexcept : _stream(&stream) {
+    }
+
+    // Errors are reported by the state of the stream, like any other `operator<<`
+    void write(const char* data, const std::size_t count) {
+        _stream->write(data, static_cast<std::streamsize>(count));
+    }
+};
+
+class FileSink {
+    std::FILE* _file{ nullptr };
+
+public:
+    explicit FileSink(std::FILE* file) noexcept : _file(file) {
+    }
+
+    // The C standard doesn't require `std::fwrite` to set `errno`, so `EIO` is reported if it didn't
+    void write(const char* data, const std::size_t count) {
+        errno = 0;
+        if (std::fwrite(data, 1, count, _file) != count) {
+            throw std::system_error(errno != 0 ? errno : EIO, std::generic_category(), "lz::writeTo");
+        }
+    }
+};
+
+// The sink that writes to an output of type `Output`, which is specialized for every type of output that `writeTo` accepts. See
+// Lz/FileDescriptor.hpp for file descriptors
+template<class Output, class = void>
+struct SinkFor {};
+
+template<class Stream>
+struct SinkFor<Stream, EnableIf<std::is_base_of<std::ostream, Stream>::value>> {
+    using type = OstreamSink;
+};
+
+template<>
+struct SinkFor<std::FILE*> {
+    using type = FileSink;
+};
+
+template<class Output>
+using SinkType = typename SinkFor<Decay<Output>>::type;
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_OUTPUT_SINK_HPP
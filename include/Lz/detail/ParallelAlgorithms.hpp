@@ -0,0 +1,310 @@
+#pragma once
+
+#ifndef LZ_PARALLEL_ALGORITHMS_HPP
+#    define LZ_PARALLEL_ALGORITHMS_HPP
+
+#    include "LzTools.hpp"
+
+#    ifdef LZ_HAS_EXECUTION
+#        include <algorithm>
+#        include <numeric>
+#        include <thread>
+#        include <vector>
+
+namespace lz {
+namespace internal {
+/*
+ * The functions below dispatch to the `std::execution` overloads of the standard algorithms, or, if a `ThreadPoolExecutor` is
+ * passed, to a block based implementation that runs on the thread pool. The pool implementations require random access
+ * iterators; for weaker iterators they fall back to the sequential algorithm. They are only declared here and defined in
+ * ThreadPool.hpp, which has to be included anyway to create a pool, so that views don't depend on the pool itself.
+ */
+template<class Iterator>
+using PoolCanSplit = IsRandomAccess<Iterator>;
+
+// Amount of blocks [0, length) is split in: at least `minBlockSize` elements per block, and at most `blocksPerThread` blocks per
+// thread so that the scheduling overhead stays small
+inline std::size_t blockCount(const std::size_t threads, const std::size_t length, const std::size_t minBlockSize = 2048,
+                              const std::size_t blocksPerThread = 4) {
+    const std::size_t maxBlocks = (threads == 0 ? 1 : threads) * blocksPerThread;
+    const std::size_t blocks = (length + minBlockSize - 1) / minBlockSize;
+    return blocks > maxBlocks ? maxBlocks : (blocks == 0 ? 1 : blocks);
+}
+
+// The amount of elements of type T that roughly fill the L1 data cache. Used as block size for algorithms that stream from the
+// input to the output, so that every block is written while it is still in cache and the blocks can be balanced over the workers
+template<class T>
+constexpr std::size_t cacheBlockSize() {
+    return sizeof(T) >= 32 * 1024 / 256 ? 256 : 32 * 1024 / sizeof(T);
+}
+
+// Calls func(blockIndex, blockBegin, blockEnd) for block `block` of [0, length) split into `blocks` blocks
+template<class Func>
+void callWithBlockBounds(Func& func, const std::size_t length, const std::size_t blocks, const std::size_t block) {
+    const std::size_t blockSize = length / blocks;
+    const std::size_t remainder = length % blocks;
+    // The first `remainder` blocks get one extra element
+    const std::size_t begin = block * blockSize + (block < remainder ? block : remainder);
+    const std::size_t end = begin + blockSize + (block < remainder ? 1 : 0);
+    func(block, begin, end);
+}
+
+template<class Execution, class Iterator, class UnaryPredicate>
+Iterator findIf(Execution execution, Iterator begin, Iterator end, UnaryPredicate predicate) {
+    return std::find_if(execution, std::move(begin), std::move(end), std::move(predicate));
+}
+
+template<class Iterator, class UnaryPredicate>
+Iterator findIf(const ThreadPoolExecutor executor, Iterator begin, Iterator end, UnaryPredicate predicate);
+
+template<class Execution, class Iterator, class UnaryPredicate>
+Iterator findIfNot(Execution execution, Iterator begin, Iterator end, UnaryPredicate predicate) {
+    return internal::findIf(execution, std::move(begin), std::move(end),
+                            [&predicate](RefType<Iterator> value) { return !predicate(std::forward<RefType<Iterator>>(value)); });
+}
+
+template<class Execution, class Iterator, class T>
+Iterator find(Execution execution, Iterator begin, Iterator end, const T& value) {
+    return internal::findIf(execution, std::move(begin), std::move(end),
+                            [&value](const ValueType<Iterator>& v) { return v == value; });
+}
+
+template<class Execution, class Iterator, class BinaryPredicate>
+Iterator adjacentFind(Execution execution, Iterator begin, Iterator end, BinaryPredicate predicate) {
+    return std::adjacent_find(execution, std::move(begin), std::move(end), std::move(predicate));
+}
+
+template<class Iterator, class BinaryPredicate>
+Iterator adjacentFind(const ThreadPoolExecutor executor, Iterator begin, Iterator end, BinaryPredicate predicate);
+
+template<class Execution, class Iterator, class UnaryPredicate>
+bool anyOf(Execution execution, Iterator begin, Iterator end, UnaryPredicate predicate) {
+    return internal::findIf(execution, begin, end, std::move(predicate)) != end;
+}
+
+template<class Execution, class Iterator, class UnaryPredicate>
+bool allOf(Execution execution, Iterator begin, Iterator end, UnaryPredicate predicate) {
+    return internal::findIfNot(execution, begin, end, std::move(predicate)) == end;
+}
+
+template<class Execution, class Iterator, class UnaryPredicate>
+bool noneOf(Execution execution, Iterator begin, Iterator end, UnaryPredicate predicate) {
+    return !internal::anyOf(execution, std::move(begin), std::move(end), std::move(predicate));
+}
+
+template<class Execution, class Iterator, class UnaryFunc>
+void forEach(Execution execution, Iterator begin, Iterator end, UnaryFunc func) {
+    std::for_each(execution, std::move(begin), std::move(end), std::move(func));
+}
+
+template<class Iterator, class UnaryFunc>
+void forEach(const ThreadPoolExecutor executor, Iterator begin, Iterator end, UnaryFunc func);
+
+template<class Execution, class Iterator, class T, class BinaryOp>
+T reduce(Execution execution, Iterator begin, Iterator end, T init, BinaryOp binaryOp) {
+    return std::reduce(execution, std::move(begin), std::move(end), std::move(init), std::move(binaryOp));
+}
+
+template<class Iterator, class T, class BinaryOp>
+T reduce(const ThreadPoolExecutor executor, Iterator begin, Iterator end, T init, BinaryOp binaryOp);
+
+template<class Execution, class Iterator, class UnaryPredicate>
+DiffType<Iterator> countIf(Execution execution, Iterator begin, Iterator end, UnaryPredicate predicate) {
+    return std::count_if(execution, std::move(begin), std::move(end), std::move(predicate));
+}
+
+template<class Iterator, class UnaryPredicate>
+DiffType<Iterator> countIf(const ThreadPoolExecutor executor, Iterator begin, Iterator end, UnaryPredicate predicate);
+
+template<class Execution, class Iterator, class T>
+DiffType<Iterator> count(Execution execution, Iterator begin, Iterator end, const T& value) {
+    return internal::countIf(execution, std::move(begin), std::move(end),
+                             [&value](const ValueType<Iterator>& v) { return v == value; });
+}
+
+template<class Execution, class Iterator, class Compare>
+Iterator minElement(Execution execution, Iterator begin, Iterator end, Compare compare) {
+    return std::min_element(execution, std::move(begin), std::move(end), std::move(compare));
+}
+
+template<class Iterator, class Compare>
+Iterator minElement(const ThreadPoolExecutor executor, Iterator begin, Iterator end, Compare compare);
+
+template<class Execution, class Iterator, class Compare>
+Iterator maxElement(Execution execution, Iterator begin, Iterator end, Compare compare) {
+    return std::max_element(execution, std::move(begin), std::move(end), std::move(compare));
+}
+
+template<class Iterator, class Compare>
+Iterator maxElement(const ThreadPoolExecutor executor, Iterator begin, Iterator end, Compare compare);
+
+template<class Execution, class Iterator, class Compare>
+void sort(Execution execution, Iterator begin, Iterator end, Compare compare) {
+    std::sort(execution, std::move(begin), std::move(end), std::move(compare));
+}
+
+template<class Iterator, class Compare>
+void sort(const ThreadPoolExecutor executor, Iterator begin, Iterator end, Compare compare);
+
+template<class Execution, class Iterator, class Compare>
+bool isSorted(Execution execution, Iterator begin, Iterator end, Compare compare) {
+    return std::is_sorted(execution, std::move(begin), std::move(end), std::move(compare));
+}
+
+template<class Iterator, class Compare>
+bool isSorted(const ThreadPoolExecutor executor, Iterator begin, Iterator end, Compare compare);
+
+template<class Execution, class Iterator, class Compare>
+void nthElement(Execution execution, Iterator begin, Iterator nth, Iterator end, Compare compare) {
+    std::nth_element(execution, std::move(begin), std::move(nth), std::move(end), std::move(compare));
+}
+
+template<class Iterator, class Compare>
+void nthElement(const ThreadPoolExecutor, Iterator begin, Iterator nth, Iterator end, Compare compare);
+
+template<class Execution, class IteratorA, class IteratorB, class BinaryPredicate>
+IteratorA search(Execution execution, IteratorA beginA, IteratorA endA, IteratorB beginB, IteratorB endB,
+                 BinaryPredicate predicate) {
+    return std::search(execution, std::move(beginA), std::move(endA), std::move(beginB), std::move(endB), std::move(predicate));
+}
+
+template<class IteratorA, class IteratorB, class BinaryPredicate>
+IteratorA search(const ThreadPoolExecutor executor, IteratorA beginA, IteratorA endA, IteratorB beginB, IteratorB endB,
+                 BinaryPredicate predicate);
+
+template<class Execution, class IteratorA, class IteratorB, class BinaryPredicate>
+bool equal(Execution execution, IteratorA beginA, IteratorA endA, IteratorB beginB, IteratorB endB, BinaryPredicate predicate) {
+    return std::equal(execution, std::move(beginA), std::move(endA), std::move(beginB), std::move(endB), std::move(predicate));
+}
+
+template<class IteratorA, class IteratorB, class BinaryPredicate>
+bool equal(const ThreadPoolExecutor executor, IteratorA beginA, IteratorA endA, IteratorB beginB, IteratorB endB,
+           BinaryPredicate predicate);
+
+template<class Execution, class Iterator, class OutputIterator, class UnaryFunc>
+OutputIterator transform(Execution execution, Iterator begin, Iterator end, OutputIterator output, UnaryFunc func) {
+    return std::transform(execution, std::move(begin), std::move(end), std::move(output), std::move(func));
+}
+
+template<class Iterator, class OutputIterator, class UnaryFunc>
+OutputIterator transform(const ThreadPoolExecutor executor, Iterator begin, Iterator end, OutputIterator output, UnaryFunc func);
+
+template<class Execution, class Iterator, class OutputIterator>
+OutputIterator copy(Execution execution, Iterator begin, Iterator end, OutputIterator output) {
+    return std::copy(execution, std::move(begin), std::move(end), std::move(output));
+}
+
+template<class Iterator, class OutputIterator>
+OutputIterator copy(const ThreadPoolExecutor executor, Iterator begin, Iterator end, OutputIterator output);
+
+// Same as forEachBlock, but for every execution policy
+template<class Execution, class Func>
+void parallelForEachBlock(Execution execution, const std::size_t length, const std::size_t blocks, Func func) {
+    std::vector<std::size_t> indices(blocks);
+    std::iota(indices.begin(), indices.end(), std::size_t{ 0 });
+    std::for_each(execution, indices.begin(), indices.end(),
+                  [&func, length, blocks](const std::size_t block) { callWithBlockBounds(func, length, blocks, block); });
+}
+
+template<class Func>
+void parallelForEachBlock(const ThreadPoolExecutor executor, const std::size_t length, const std::size_t blocks, Func func);
+
+template<class Execution>
+std::size_t threadCount(Execution) {
+    return static_cast<std::size_t>(std::thread::hardware_concurrency());
+}
+
+inline std::size_t threadCount(const ThreadPoolExecutor executor);
+
+/**
+ * Parallel stream compaction of a random access sequence: the predicate is evaluated in parallel blocks, which gives a match
+ * count per block. An exclusive prefix sum over these counts gives the output offset of every block, so that `scatter` can write
+ * every block in parallel into a single, exactly sized output. Elements that are computed on dereference (e.g. the elements of
+ * a map) are stored per block while counting, so that every element is evaluated once.
+ */
+template<class Execution, class Iterator>
+class Compaction {
+    using Diff = DiffType<Iterator>;
+    using Value = ValueType<Iterator>;
+
+    static constexpr bool CachesValues = !std::is_lvalue_reference<RefType<Iterator>>::value;
+
+    Execution _execution{};
+    std::size_t _length{};
+    std::size_t _blocks{};
+    std::vector<unsigned char> _matches;
+    std::vector<std::vector<Value>> _values;
+    std::vector<std::size_t> _offsets;
+
+public:
+    template<class UnaryPredicate>
+    Compaction(Execution execution, const Iterator& begin, const Iterator& end, UnaryPredicate& predicate) :
+        _execution(execution),
+        _length(static_cast<std::size_t>(end - begin)),
+        _blocks(blockCount(threadCount(execution), _length, 2048, 8)),
+        _matches(CachesValues ? 0 : _length),
+        _values(CachesValues ? _blocks : 0),
+        _offsets(_blocks + 1) {
+        parallelForEachBlock(_execution, _length, _blocks,
+                             [this, &begin, &predicate](const std::size_t block, const std::size_t first,
+                                                        const std::size_t last) {
+                                 std::size_t count = 0;
+                                 for (std::size_t i = first; i < last; ++i) {
+                                     auto&& value = begin[static_cast<Diff>(i)];
+                                     const bool match = predicate(value);
+                                     if constexpr (CachesValues) {
+                                         if (match) {
+                                             _values[block].push_back(std::forward<decltype(value)>(value));
+                                         }
+                                     }
+                                     else {
+                                         _matches[i] = static_cast<unsigned char>(match);
+                                     }
+                                     count += static_cast<std::size_t>(match);
+                                 }
+                                 _offsets[block + 1] = count;
+                             });
+        std::partial_sum(_offsets.begin(), _offsets.end(), _offsets.begin());
+    }
+
+    // The amount of matches
+    LZ_NODISCARD std::size_t size() const noexcept {
+        return _offsets.back();
+    }
+
+    // Copies the matches of [begin, begin + length) to [output, output + size())
+    template<class OutputIterator>
+    void scatter(const Iterator& begin, const OutputIterator& output) {
+        using OutDiff = DiffType<OutputIterator>;
+        parallelForEachBlock(_execution, _length, _blocks,
+                             [this, &begin, &output](const std::size_t block, const std::size_t first, const std::size_t last) {
+                                 auto out = output + static_cast<OutDiff>(_offsets[block]);
+                                 if constexpr (CachesValues) {
+                                     static_cast<void>(begin);
+                                     static_cast<void>(first);
+                                     static_cast<void>(last);
+                                     std::move(_values[block].begin(), _values[block].end(), out);
+                                 }
+                                 else {
+                                     for (std::size_t i = first; i < last; ++i) {
+                                         if (_matches[i] != 0) {
+                                             *out = begin[static_cast<Diff>(i)];
+                                             ++out;
+                                         }
+                                     }
+                                 }
+                             });
+    }
+};
+
+// Iterators that can be collected in parallel blocks directly into their final place in the output. These iterators provide the
+// hidden friends `compact(begin, end)`, which returns an object with a `size()` member that contains the total amount of
+// elements, and `scatter(begin, compaction, output)`, that writes the elements to the random access iterator `output`. See for
+// instance FilterIterator
+template<class Iterator>
+struct IsCompactable : std::false_type {};
+} // namespace internal
+} // namespace lz
+#    endif // LZ_HAS_EXECUTION
+
+#endif // LZ_PARALLEL_ALGORITHMS_HPP
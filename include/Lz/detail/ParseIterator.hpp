@@ -0,0 +1,245 @@
+#pragma once
+
+#ifndef LZ_PARSE_ITERATOR_HPP
+#define LZ_PARSE_ITERATOR_HPP
+
+#include "LzTools.hpp"
+
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <system_error>
+
+#if defined(LZ_HAS_CXX_17) && LZ_HAS_INCLUDE(<charconv>)
+#    include <charconv>
+#    define LZ_HAS_FROM_CHARS
+#    if defined(__cpp_lib_to_chars)
+#        define LZ_HAS_FROM_CHARS_FLOAT
+#    endif // __cpp_lib_to_chars
+#endif // LZ_HAS_CXX_17 && <charconv>
+
+namespace lz {
+/**
+ * The result of parsing a string as an arithmetic type. `error` is `std::errc()` if the parse succeeded,
+ * `std::errc::invalid_argument` if the string is not a number (or contains anything after it) and
+ * `std::errc::result_out_of_range` if the number does not fit in `T`.
+ */
+template<class T>
+struct ParseResult {
+    T value{};
+    std::errc error{};
+
+    constexpr explicit operator bool() const noexcept {
+        return error == std::errc();
+    }
+
+    // Returns the parsed value, or `fallback` if the parse failed
+    constexpr T valueOr(const T fallback) const noexcept {
+        return error == std::errc() ? value : fallback;
+    }
+};
+
+namespace internal {
+#ifdef LZ_HAS_FROM_CHARS
+template<class T>
+ParseResult<T> parseInteger(const char* first, const char* last) noexcept {
+    ParseResult<T> result;
+    const std::from_chars_result parsed = std::from_chars(first, last, result.value);
+    result.error = parsed.ptr != last ? std::errc::invalid_argument : parsed.ec;
+    return result;
+}
+#else
+// Same rules as `std::from_chars` with base 10: an optional minus sign (only for signed types), followed by digits only
+template<class T>
+ParseResult<T> parseInteger(const char* first, const char* last) noexcept {
+    ParseResult<T> result;
+    const bool negative = std::numeric_limits<T>::is_signed && first != last && *first == '-';
+    first += static_cast<std::ptrdiff_t>(negative);
+    if (first == last) {
+        result.error = std::errc::invalid_argument;
+        return result;
+    }
+    // Accumulated as a negative number for signed types, so that the minimum value can be represented as well
+    const T limit = negative ? (std::numeric_limits<T>::min)() : (std::numeric_limits<T>::max)();
+    T value = 0;
+    for (; first != last; ++first) {
+        const auto digit = static_cast<unsigned>(static_cast<unsigned char>(*first) - static_cast<unsigned char>('0'));
+        if (digit > 9) {
+            result.error = std::errc::invalid_argument;
+            return result;
+        }
+        if (result.error != std::errc()) {
+            // Out of range, but the rest must still be digits
+            continue;
+        }
+        const auto d = static_cast<T>(digit);
+        if (negative ? value < (limit + d) / 10 : value > (limit - d) / 10) {
+            result.error = std::errc::result_out_of_range;
+            continue;
+        }
+        value = static_cast<T>(negative ? value * 10 - d : value * 10 + d);
+    }
+    if (result.error == std::errc()) {
+        result.value = value;
+    }
+    return result;
+}
+#endif // LZ_HAS_FROM_CHARS
+
+#ifdef LZ_HAS_FROM_CHARS_FLOAT
+template<class T>
+ParseResult<T> parseFloatingPoint(const char* first, const char* last) noexcept {
+    ParseResult<T> result;
+    const std::from_chars_result parsed = std::from_chars(first, last, result.value);
+    result.error = parsed.ptr != last ? std::errc::invalid_argument : parsed.ec;
+    return result;
+}
+#else
+inline void strToFloat(const char* string, char** end, float& value) noexcept {
+    value = std::strtof(string, end);
+}
+
+inline void strToFloat(const char* string, char** end, double& value) noexcept {
+    value = std::strtod(string, end);
+}
+
+inline void strToFloat(const char* string, char** end, long double& value) noexcept {
+    value = std::strtold(string, end);
+}
+
+// `strto*` needs a null terminated string, so short strings are copied to the stack. Whitespace, a plus sign and hexadecimal
+// numbers are rejected, like `std::from_chars` does
+template<class T>
+ParseResult<T> parseFloatingPoint(const char* first, const char* last) {
+    ParseResult<T> result;
+    const auto length = static_cast<std::size_t>(last - first);
+    if (length == 0 || *first == '+' || std::isspace(static_cast<unsigned char>(*first)) ||
+        std::memchr(first, 'x', length) != nullptr || std::memchr(first, 'X', length) != nullptr) {
+        result.error = std::errc::invalid_argument;
+        return result;
+    }
+    char buffer[64];
+    std::string heapBuffer;
+    const char* string = buffer;
+    if (length < sizeof buffer) {
+        std::memcpy(buffer, first, length);
+        buffer[length] = '\0';
+    }
+    else {
+        heapBuffer.assign(first, length);
+        string = heapBuffer.c_str();
+    }
+    char* end = nullptr;
+    const int previousErrno = errno;
+    errno = 0;
+    T value{};
+    strToFloat(string, &end, value);
+    if (end != string + length) {
+        result.error = std::errc::invalid_argument;
+    }
+    else if (errno == ERANGE) {
+        result.error = std::errc::result_out_of_range;
+    }
+    else {
+        result.value = value;
+    }
+    errno = previousErrno;
+    return result;
+}
+#endif // LZ_HAS_FROM_CHARS_FLOAT
+
+template<class T>
+ParseResult<T> parseChars(const char* first, const char* last, std::true_type /* isFloatingPoint */) {
+    return parseFloatingPoint<T>(first, last);
+}
+
+template<class T>
+ParseResult<T> parseChars(const char* first, const char* last, std::false_type /* isFloatingPoint */) {
+    return parseInteger<T>(first, last);
+}
+
+// Parses a string-like object (anything with `data()` and `size()`, like `std::string_view`) without copying it
+template<class T>
+struct ParseFn {
+    static_assert(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value, "T must be an arithmetic type other than bool");
+
+    template<class String>
+    ParseResult<T> operator()(const String& string) const {
+        const char* first = string.data();
+        return parseChars<T>(first, first + string.size(), std::is_floating_point<T>());
+    }
+};
+
+/**
+ * Parses every string of the underlying sequence, and skips the ones that cannot be parsed. The result of the current string is
+ * stored in the iterator, so that every string is parsed once.
+ */
+template<class Iterator, class T>
+class ParseValidIterator {
+    using IterTraits = std::iterator_traits<Iterator>;
+
+    Iterator _iterator{};
+    Iterator _end{};
+    ParseResult<T> _current{};
+
+    void findValid() {
+        for (; _iterator != _end; ++_iterator) {
+            _current = ParseFn<T>()(*_iterator);
+            if (_current) {
+                return;
+            }
+        }
+    }
+
+public:
+    using iterator_category = typename std::common_type<std::forward_iterator_tag, typename IterTraits::iterator_category>::type;
+    using value_type = T;
+    using reference = T;
+    using difference_type = typename IterTraits::difference_type;
+    using pointer = FakePointerProxy<reference>;
+
+    ParseValidIterator(Iterator iterator, Iterator end) : _iterator(std::move(iterator)), _end(std::move(end)) {
+        findValid();
+    }
+
+    ParseValidIterator() = default;
+
+    LZ_NODISCARD reference operator*() const noexcept {
+        return _current.value;
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    ParseValidIterator& operator++() {
+        ++_iterator;
+        findValid();
+        return *this;
+    }
+
+    ParseValidIterator operator++(int) {
+        ParseValidIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD friend bool operator!=(const ParseValidIterator& a, const ParseValidIterator& b) {
+        return a._iterator != b._iterator;
+    }
+
+    LZ_NODISCARD friend bool operator==(const ParseValidIterator& a, const ParseValidIterator& b) {
+        return !(a != b); // NOLINT
+    }
+
+    LZ_NODISCARD friend SizeHint sizeHint(const ParseValidIterator& begin, const ParseValidIterator& end) {
+        return { begin != end ? 1u : 0u, getSizeHint(begin._iterator, end._iterator).upper };
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_PARSE_ITERATOR_HPP
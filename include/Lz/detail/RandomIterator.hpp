@@ -7,7 +7,15 @@
 
 namespace lz {
 namespace internal {
-template<LZ_CONCEPT_ARITHMETIC Arithmetic, class Distribution, class Generator>
+// Engines of at most a cache line, like `lz::Xoshiro256StarStar`, are cheap enough to be copied into the iterators
+template<class Generator>
+struct IsSmallEngine : std::integral_constant<bool, sizeof(Generator) <= 64> {};
+
+/**
+ * If `InlineGenerator` is true, every iterator contains its own copy of the engine, so that generating a number needs no
+ * indirection. Copies of such an iterator generate the same numbers. Otherwise the iterator points to the engine.
+ */
+template<LZ_CONCEPT_ARITHMETIC Arithmetic, class Distribution, class Generator, bool InlineGenerator = false>
 class RandomIterator {
 public:
     using iterator_category = std::random_access_iterator_tag;
@@ -18,10 +26,28 @@ public:
     using result_type = value_type;
 
 private:
+    using GeneratorStorage = Conditional<InlineGenerator, Generator, Generator*>;
+
     mutable Distribution _distribution{};
     std::ptrdiff_t _current{};
     bool _isWhileTrueLoop{};
-    Generator* _generator{ nullptr };
+    mutable GeneratorStorage _generator{};
+
+    static Generator* store(Generator& generator, std::false_type /* inlineGenerator */) noexcept {
+        return &generator;
+    }
+
+    static const Generator& store(const Generator& generator, std::true_type /* inlineGenerator */) noexcept {
+        return generator;
+    }
+
+    static Generator& engine(Generator* generator) noexcept {
+        return *generator;
+    }
+
+    static Generator& engine(Generator& generator) noexcept {
+        return generator;
+    }
 
 public:
     RandomIterator(const Distribution& distribution, Generator& generator, const std::ptrdiff_t current,
@@ -29,17 +55,17 @@ public:
         _distribution(distribution),
         _current(current),
         _isWhileTrueLoop(isWhileTrueLoop),
-        _generator(&generator) {
+        _generator(store(generator, std::integral_constant<bool, InlineGenerator>())) {
     }
 
     RandomIterator() = default;
 
     LZ_NODISCARD value_type operator*() const {
-        return _distribution(*_generator);
+        return _distribution(engine(_generator));
     }
 
     LZ_NODISCARD value_type operator()() const {
-        return _distribution(*_generator);
+        return _distribution(engine(_generator));
     }
 
     LZ_NODISCARD pointer operator->() const {
@@ -98,8 +124,9 @@ public:
         return a._current - b._current;
     }
 
-    LZ_NODISCARD value_type operator[](const difference_type offset) const noexcept {
-        return *(*this + offset);
+    // Every number is random, regardless of the offset, so the engine of this iterator is used
+    LZ_NODISCARD value_type operator[](const difference_type) const {
+        return **this;
     }
 
     RandomIterator& operator++() noexcept {
@@ -93,6 +93,9 @@ public:
         return { _iterator + static_cast<Arithmetic>(value) * _step, _step };
     }
 };
+
+template<class Arithmetic>
+struct IsSized<RangeIterator<Arithmetic>> : std::true_type {};
 } // namespace internal
 
 /**
@@ -0,0 +1,104 @@
+#pragma once
+
+#ifndef LZ_SPLIT_ANY_ITERATOR_HPP
+#define LZ_SPLIT_ANY_ITERATOR_HPP
+
+#include "CharSearch.hpp"
+#include "LzTools.hpp"
+
+#include <string>
+
+namespace lz {
+namespace internal {
+/**
+ * Splits a string on every character that is in a `CharSet`. The characters are classified 64 at a time and the classification of
+ * the current block is kept in the iterator. If `collapse` is true, consecutive delimiters are treated as one, and no empty
+ * substrings are returned at all.
+ */
+template<class SubString, class String>
+class SplitAnyIterator {
+    std::size_t _currentPos{}, _last{};
+    const String* _string{ nullptr };
+    CharSet _delimiters{};
+    DelimiterBlock _block{};
+    bool _collapse{};
+
+    template<bool InSet>
+    std::size_t find(const std::size_t pos) {
+        return findCharClass<InSet>(_string->data(), _string->size(), pos, _delimiters, _block);
+    }
+
+    void findToken(const std::size_t pos) {
+        _currentPos = _collapse ? find<false>(pos) : pos;
+        if (_currentPos == std::string::npos) {
+            _currentPos = _string->size();
+            return;
+        }
+        _last = find<true>(_currentPos);
+    }
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = SubString;
+    using reference = SubString;
+    using difference_type = std::ptrdiff_t;
+    using pointer = FakePointerProxy<reference>;
+
+    SplitAnyIterator(const std::size_t startingPosition, const String& string, const CharSet& delimiters, const bool collapse) :
+        _currentPos(startingPosition),
+        _last(std::string::npos),
+        _string(&string),
+        _delimiters(delimiters),
+        _collapse(collapse) {
+        if (startingPosition == 0 && !_string->empty()) {
+            findToken(0);
+        }
+    }
+
+    SplitAnyIterator() = default;
+
+    value_type operator*() const {
+        const std::size_t end = _last == std::string::npos ? _string->size() : _last;
+        return SubString(_string->data() + _currentPos, end - _currentPos);
+    }
+
+    pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    constexpr friend bool operator!=(const SplitAnyIterator& a, const SplitAnyIterator& b) noexcept {
+        return a._currentPos != b._currentPos;
+    }
+
+    constexpr friend bool operator==(const SplitAnyIterator& a, const SplitAnyIterator& b) noexcept {
+        return !(a != b); // NOLINT
+    }
+
+    LZ_NODISCARD constexpr friend SizeHint sizeHint(const SplitAnyIterator& begin, const SplitAnyIterator& end) noexcept {
+        // Every substring consumes at least one character, either of itself or of the delimiter
+        return begin._currentPos < end._currentPos ? SizeHint(1, end._currentPos - begin._currentPos) : SizeHint(0, 0);
+    }
+
+    SplitAnyIterator& operator++() noexcept {
+        const std::size_t stringLen = _string->size();
+        if (_last == std::string::npos || _last == stringLen - 1) {
+            // The last substring, or the string ends with a delimiter
+            _currentPos = stringLen;
+            _last = std::string::npos;
+        }
+        else {
+            findToken(_last + 1);
+        }
+        return *this;
+    }
+
+    SplitAnyIterator operator++(int) noexcept {
+        SplitAnyIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_SPLIT_ANY_ITERATOR_HPP
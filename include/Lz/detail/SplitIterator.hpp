@@ -3,24 +3,66 @@
 #ifndef LZ_SPLIT_ITERATOR_HPP
 #define LZ_SPLIT_ITERATOR_HPP
 
+#include "CharSearch.hpp"
 #include "LzTools.hpp"
 
+#include <memory>
 #include <string>
 
 namespace lz {
 namespace internal {
+/**
+ * Delimiters of 1 to `maxScanDelimiterLength` characters are searched using `findDelimiter`, which classifies the string 64
+ * characters at a time and keeps the delimiter positions of the current block, so that short tokens don't need a search call
+ * each. Longer delimiters are moved into a `HorspoolSearcher`, which is shared by all copies of the iterator, so that its skip
+ * table is built only once and copying the iterator doesn't copy the delimiter. The searcher makes the iterator unusable in
+ * constant expressions.
+ */
 template<class SubString, class String, class StringType>
 class SplitIterator {
+    using IsChar = std::is_same<StringType, char>;
+
     std::size_t _currentPos{}, _last{};
     const String* _string{ nullptr };
     StringType _delimiter{};
+    DelimiterBlock _block{};
+    std::shared_ptr<const HorspoolSearcher> _searcher{};
 
     constexpr std::size_t getLength(std::true_type /* isChar */) const {
         return 1;
     }
 
-    LZ_CONSTEXPR_CXX_20 std::size_t getLength(std::false_type /* isChar */) const {
-        return _delimiter.length();
+    std::size_t getLength(std::false_type /* isChar */) const {
+        return _searcher ? _searcher->pattern().length() : _delimiter.length();
+    }
+
+    void makeSearcher(std::true_type /* isChar */) noexcept {
+    }
+
+    void makeSearcher(std::false_type /* isChar */) {
+        if (_delimiter.length() > maxScanDelimiterLength) {
+            _searcher = std::make_shared<const HorspoolSearcher>(std::move(_delimiter));
+            _delimiter = StringType();
+        }
+    }
+
+    const char* delimiterData(std::true_type /* isChar */) const noexcept {
+        return &_delimiter;
+    }
+
+    const char* delimiterData(std::false_type /* isChar */) const noexcept {
+        return _delimiter.data();
+    }
+
+    std::size_t find(const std::size_t pos) {
+        const std::size_t length = getLength(IsChar());
+        if (_searcher) {
+            return _searcher->find(_string->data(), _string->size(), pos);
+        }
+        if (length == 0 || length > maxScanDelimiterLength) {
+            return _string->find(_delimiter, pos);
+        }
+        return findDelimiter(_string->data(), _string->size(), pos, delimiterData(IsChar()), length, _block);
     }
 
 public:
@@ -30,18 +72,32 @@ public:
     using difference_type = std::ptrdiff_t;
     using pointer = FakePointerProxy<reference>;
 
-    LZ_CONSTEXPR_CXX_20 SplitIterator(const std::size_t startingPosition, const String& string, StringType delimiter) :
+    SplitIterator(const std::size_t startingPosition, const String& string, StringType delimiter) :
         _currentPos(startingPosition),
         _string(&string),
         _delimiter(std::move(delimiter)) {
         // Micro optimization, check if object is created from begin(), only then we want to search
         if (startingPosition == 0) {
-            _last = _string->find(_delimiter, _currentPos);
+            makeSearcher(IsChar());
+            _last = find(_currentPos);
         }
     }
 
     SplitIterator() = default;
 
+    // The string and delimiter of a begin iterator, for e.g. building a `SplitIndex`
+    LZ_NODISCARD const String& string() const noexcept {
+        return *_string;
+    }
+
+    LZ_NODISCARD const char* delimiter() const noexcept {
+        return _searcher ? _searcher->pattern().data() : delimiterData(IsChar());
+    }
+
+    LZ_NODISCARD std::size_t delimiterLength() const {
+        return getLength(IsChar());
+    }
+
     LZ_CONSTEXPR_CXX_20 value_type operator*() const {
         if (_last != std::string::npos) {
             return SubString(&(*_string)[_currentPos], _last - _currentPos);
@@ -63,8 +119,13 @@ public:
         return !(a != b); // NOLINT
     }
 
-    LZ_CONSTEXPR_CXX_20 SplitIterator& operator++() noexcept {
-        const std::size_t delimLen = getLength(std::is_same<StringType, char>());
+    LZ_NODISCARD constexpr friend SizeHint sizeHint(const SplitIterator& begin, const SplitIterator& end) noexcept {
+        // Every substring consumes at least one character, either of itself or of the delimiter
+        return begin._currentPos < end._currentPos ? SizeHint(1, end._currentPos - begin._currentPos) : SizeHint(0, 0);
+    }
+
+    SplitIterator& operator++() noexcept {
+        const std::size_t delimLen = getLength(IsChar());
         const std::size_t stringLen = _string->length();
         if (_last == std::string::npos) {
             _currentPos = stringLen;
@@ -76,12 +137,12 @@ public:
         }
         else {
             _currentPos = _last + delimLen;
-            _last = _string->find(_delimiter, _currentPos);
+            _last = find(_currentPos);
         }
         return *this;
     }
 
-    LZ_CONSTEXPR_CXX_20 SplitIterator operator++(int) noexcept {
+    SplitIterator operator++(int) noexcept {
         SplitIterator tmp(*this);
         ++*this;
         return tmp;
@@ -34,6 +34,27 @@ public:
         }
     }
 
+    template<class UnaryFunc>
+    LZ_CONSTEXPR_CXX_20 bool forEachUntilImpl(const TakeEveryIterator& end, UnaryFunc& func, std::random_access_iterator_tag) {
+        const difference_type length = end._iterator - _iterator;
+        for (difference_type i = 0; i < length; i += _offset) {
+            if (func(_iterator[i])) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template<class UnaryFunc>
+    LZ_CONSTEXPR_CXX_20 bool forEachUntilImpl(const TakeEveryIterator& end, UnaryFunc& func, std::input_iterator_tag) {
+        for (; _iterator != end._iterator; this->next()) {
+            if (func(*_iterator)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
 public:
     LZ_CONSTEXPR_CXX_20
     TakeEveryIterator(Iterator iterator, Iterator end, const difference_type offset, const difference_type distance) :
@@ -92,7 +113,21 @@ public:
         }
         return { next(_iterator, diffOffset), _end, _offset, dist };
     }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend SizeHint sizeHint(const TakeEveryIterator& begin, const TakeEveryIterator& end) {
+        const auto hint = getSizeHint(begin._iterator, end._iterator);
+        const auto offset = static_cast<std::size_t>(begin._offset);
+        return { (hint.lower + offset - 1) / offset, hint.hasUpper() ? (hint.upper + offset - 1) / offset : hint.upper };
+    }
+
+    template<class UnaryFunc>
+    LZ_CONSTEXPR_CXX_20 friend bool forEachUntil(TakeEveryIterator begin, const TakeEveryIterator& end, UnaryFunc&& func) {
+        return begin.forEachUntilImpl(end, func, IterCat<Iterator>());
+    }
 };
+
+template<class Iterator>
+struct IsSized<TakeEveryIterator<Iterator>> : IsSized<Iterator> {};
 } // namespace internal
 
 /**
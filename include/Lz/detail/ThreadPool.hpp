@@ -0,0 +1,548 @@
+#pragma once
+
+#ifndef LZ_THREAD_POOL_HPP
+#    define LZ_THREAD_POOL_HPP
+
+#    include "LzTools.hpp"
+#    include "ParallelAlgorithms.hpp"
+
+#    include <algorithm>
+#    include <atomic>
+#    include <condition_variable>
+#    include <deque>
+#    include <exception>
+#    include <functional>
+#    include <memory>
+#    include <mutex>
+#    include <numeric>
+#    include <thread>
+#    include <vector>
+
+namespace lz {
+/**
+ * A work stealing thread pool. Every worker has its own task deque. A worker takes tasks from the back of its own deque and,
+ * when that is empty, steals from the front of the deques of the other workers. A thread that waits for its tasks to complete
+ * (e.g. in `parallelFor`) executes tasks itself in the meantime, so nested parallelism cannot deadlock. Use `executor()` to pass
+ * this pool to functions that accept an execution policy, e.g. `lz::filter(vec, pred, pool.executor())`.
+ */
+class ThreadPool {
+    struct TaskQueue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    struct ThreadState {
+        const ThreadPool* pool{ nullptr };
+        std::size_t index{};
+    };
+
+    std::vector<std::unique_ptr<TaskQueue>> _queues;
+    std::vector<std::thread> _threads;
+    std::mutex _sleepMutex;
+    std::condition_variable _wake;
+    std::atomic<std::size_t> _pending{ 0 };
+    std::atomic<std::size_t> _nextQueue{ 0 };
+    bool _stop{ false };
+
+    static ThreadState& threadState() noexcept {
+        static thread_local ThreadState state;
+        return state;
+    }
+
+    // Returns the queue of the calling thread if it is a worker of this pool, otherwise picks one in a round robin fashion
+    std::size_t queueIndexForThisThread() noexcept {
+        const ThreadState& state = threadState();
+        if (state.pool == this) {
+            return state.index;
+        }
+        return _nextQueue.fetch_add(1, std::memory_order_relaxed) % _queues.size();
+    }
+
+    bool tryPop(const std::size_t self, std::function<void()>& task) {
+        {
+            TaskQueue& own = *_queues[self];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (!own.tasks.empty()) {
+                task = std::move(own.tasks.back());
+                own.tasks.pop_back();
+                _pending.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        for (std::size_t i = 1; i < _queues.size(); ++i) {
+            TaskQueue& victim = *_queues[(self + i) % _queues.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty()) {
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                _pending.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void workerLoop(const std::size_t index) {
+        ThreadState& state = threadState();
+        state.pool = this;
+        state.index = index;
+
+        std::function<void()> task;
+        while (true) {
+            if (tryPop(index, task)) {
+                task();
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(_sleepMutex);
+            _wake.wait(lock, [this] { return _stop || _pending.load(std::memory_order_relaxed) != 0; });
+            if (_stop && _pending.load(std::memory_order_relaxed) == 0) {
+                return;
+            }
+        }
+    }
+
+    static std::size_t defaultThreadCount() noexcept {
+        const auto count = static_cast<std::size_t>(std::thread::hardware_concurrency());
+        return count == 0 ? 1 : count;
+    }
+
+public:
+    /**
+     * Creates a thread pool with `threadCount` worker threads.
+     * @param threadCount The amount of worker threads. Defaults to `std::thread::hardware_concurrency()`.
+     */
+    explicit ThreadPool(const std::size_t threadCount = defaultThreadCount()) {
+        const std::size_t count = threadCount == 0 ? 1 : threadCount;
+        _queues.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            _queues.emplace_back(new TaskQueue());
+        }
+        _threads.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            _threads.emplace_back([this, i] { workerLoop(i); });
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(_sleepMutex);
+            _stop = true;
+        }
+        _wake.notify_all();
+        for (std::thread& thread : _threads) {
+            thread.join();
+        }
+    }
+
+    /**
+     * Returns the amount of worker threads.
+     */
+    LZ_NODISCARD std::size_t size() const noexcept {
+        return _threads.size();
+    }
+
+    /**
+     * Schedules `task` to be executed by one of the workers. If called from a worker, the task is pushed to the deque of that
+     * worker.
+     * @param task The task to execute. Must have the signature `void()`.
+     */
+    template<class Task>
+    void submit(Task&& task) {
+        TaskQueue& queue = *_queues[queueIndexForThisThread()];
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.tasks.emplace_back(std::forward<Task>(task));
+            // Counted before the queue is unlocked, otherwise a thief could pop the task and count it down first
+            _pending.fetch_add(1, std::memory_order_relaxed);
+        }
+        {
+            // A worker checks `_pending` under this lock before it sleeps, so the notification cannot be lost
+            std::lock_guard<std::mutex> lock(_sleepMutex);
+        }
+        _wake.notify_one();
+    }
+
+    /**
+     * Calls `func(i)` for every `i` in [0, `count`) in parallel and blocks until all calls are done. The calling thread executes
+     * tasks as well while waiting. If one of the calls throws, the first exception is rethrown after all calls are done.
+     * @param count The amount of calls.
+     * @param func The function to call. Must have the signature `void(std::size_t)`.
+     */
+    template<class Func>
+    void parallelFor(const std::size_t count, Func func) {
+        if (count == 0) {
+            return;
+        }
+        if (count == 1) {
+            func(0);
+            return;
+        }
+
+        std::atomic<std::size_t> remaining{ count };
+        std::mutex doneMutex;
+        std::condition_variable done;
+        std::exception_ptr error;
+
+        auto run = [&](const std::size_t i) {
+            std::exception_ptr exception;
+            try {
+                func(i);
+            }
+            catch (...) {
+                exception = std::current_exception();
+            }
+            // Counted down and notified under the lock, so the waiting thread cannot see the count reach zero and destroy
+            // `doneMutex` and `done` while this task still uses them
+            std::lock_guard<std::mutex> lock(doneMutex);
+            if (exception && !error) {
+                error = exception;
+            }
+            if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                done.notify_all();
+            }
+        };
+
+        for (std::size_t i = 1; i < count; ++i) {
+            submit([&run, i] { run(i); });
+        }
+        run(0);
+
+        const std::size_t self = queueIndexForThisThread();
+        std::function<void()> task;
+        while (remaining.load(std::memory_order_acquire) != 0) {
+            if (tryPop(self, task)) {
+                task();
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(doneMutex);
+            done.wait(lock, [&remaining] { return remaining.load(std::memory_order_acquire) == 0; });
+        }
+        // The last task counts down while holding the lock, so this waits until it has released it
+        std::lock_guard<std::mutex> lock(doneMutex);
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    /**
+     * Returns a lightweight handle to this pool that can be passed wherever an execution policy is accepted.
+     */
+    LZ_NODISCARD ThreadPoolExecutor executor() noexcept;
+};
+
+/**
+ * A handle to a `lz::ThreadPool`, obtained by `ThreadPool::executor()`. Can be passed wherever an execution policy
+ * (`std::execution::*`) is accepted. A default constructed executor has no pool and runs sequentially.
+ */
+class ThreadPoolExecutor {
+    ThreadPool* _pool{ nullptr };
+
+public:
+    constexpr ThreadPoolExecutor() = default;
+
+    constexpr explicit ThreadPoolExecutor(ThreadPool& pool) noexcept : _pool(&pool) {
+    }
+
+    LZ_NODISCARD constexpr ThreadPool* pool() const noexcept {
+        return _pool;
+    }
+};
+
+inline ThreadPoolExecutor ThreadPool::executor() noexcept {
+    return ThreadPoolExecutor(*this);
+}
+
+#    ifdef LZ_HAS_EXECUTION
+namespace internal {
+// Splits [0, length) into `blocks` blocks and calls func(blockIndex, blockBegin, blockEnd) for every block on the pool
+template<class Func>
+void forEachBlock(ThreadPool& pool, const std::size_t length, const std::size_t blocks, Func func) {
+    pool.parallelFor(blocks, [&func, length, blocks](const std::size_t block) { callWithBlockBounds(func, length, blocks, block); });
+}
+
+template<class Func>
+void forEachBlock(ThreadPool& pool, const std::size_t length, Func func) {
+    forEachBlock(pool, length, blockCount(pool.size(), length), std::move(func));
+}
+
+// Finds the first index in [0, length) for which `predicate(index)` returns true, or `length` if none
+template<class IndexPredicate>
+std::size_t findFirstIndex(ThreadPool& pool, const std::size_t length, IndexPredicate predicate) {
+    std::atomic<std::size_t> found{ length };
+    forEachBlock(pool, length, [&found, &predicate](std::size_t, const std::size_t begin, const std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            if (found.load(std::memory_order_relaxed) < begin) {
+                return;
+            }
+            if (predicate(i)) {
+                std::size_t current = found.load(std::memory_order_relaxed);
+                while (i < current && !found.compare_exchange_weak(current, i, std::memory_order_relaxed)) {
+                }
+                return;
+            }
+        }
+    });
+    return found.load();
+}
+
+template<class Iterator, class UnaryPredicate>
+Iterator findIf(const ThreadPoolExecutor executor, Iterator begin, Iterator end, UnaryPredicate predicate) {
+    if constexpr (PoolCanSplit<Iterator>::value) {
+        if (executor.pool() != nullptr) {
+            const auto length = static_cast<std::size_t>(end - begin);
+            const std::size_t index = findFirstIndex(*executor.pool(), length, [&begin, &predicate](const std::size_t i) {
+                return static_cast<bool>(predicate(begin[static_cast<DiffType<Iterator>>(i)]));
+            });
+            return begin + static_cast<DiffType<Iterator>>(index);
+        }
+    }
+    return std::find_if(std::move(begin), std::move(end), std::move(predicate));
+}
+
+template<class Iterator, class BinaryPredicate>
+Iterator adjacentFind(const ThreadPoolExecutor executor, Iterator begin, Iterator end, BinaryPredicate predicate) {
+    if constexpr (PoolCanSplit<Iterator>::value) {
+        if (executor.pool() != nullptr && begin != end) {
+            using Diff = DiffType<Iterator>;
+            const auto length = static_cast<std::size_t>(end - begin) - 1;
+            const std::size_t index = findFirstIndex(*executor.pool(), length, [&begin, &predicate](const std::size_t i) {
+                return static_cast<bool>(predicate(begin[static_cast<Diff>(i)], begin[static_cast<Diff>(i + 1)]));
+            });
+            return index == length ? end : begin + static_cast<Diff>(index);
+        }
+    }
+    return std::adjacent_find(std::move(begin), std::move(end), std::move(predicate));
+}
+
+template<class Iterator, class UnaryFunc>
+void forEach(const ThreadPoolExecutor executor, Iterator begin, Iterator end, UnaryFunc func) {
+    if constexpr (PoolCanSplit<Iterator>::value) {
+        if (executor.pool() != nullptr) {
+            using Diff = DiffType<Iterator>;
+            forEachBlock(*executor.pool(), static_cast<std::size_t>(end - begin),
+                         [&begin, &func](std::size_t, const std::size_t first, const std::size_t last) {
+                             std::for_each(begin + static_cast<Diff>(first), begin + static_cast<Diff>(last), func);
+                         });
+            return;
+        }
+    }
+    std::for_each(std::move(begin), std::move(end), std::move(func));
+}
+
+template<class Iterator, class T, class BinaryOp>
+T reduce(const ThreadPoolExecutor executor, Iterator begin, Iterator end, T init, BinaryOp binaryOp) {
+    if constexpr (PoolCanSplit<Iterator>::value) {
+        if (executor.pool() != nullptr && begin != end) {
+            using Diff = DiffType<Iterator>;
+            ThreadPool& pool = *executor.pool();
+            const auto length = static_cast<std::size_t>(end - begin);
+            // Every block is folded separately, after which the blocks are folded in order onto init
+            std::vector<std::unique_ptr<T>> partials(blockCount(pool.size(), length));
+            forEachBlock(pool, length,
+                         [&begin, &binaryOp, &partials](const std::size_t block, const std::size_t first, const std::size_t last) {
+                             T result = begin[static_cast<Diff>(first)];
+                             for (std::size_t i = first + 1; i < last; ++i) {
+                                 result = binaryOp(std::move(result), begin[static_cast<Diff>(i)]);
+                             }
+                             partials[block].reset(new T(std::move(result)));
+                         });
+            for (std::unique_ptr<T>& partial : partials) {
+                init = binaryOp(std::move(init), std::move(*partial));
+            }
+            return init;
+        }
+    }
+    return std::accumulate(std::move(begin), std::move(end), std::move(init), std::move(binaryOp));
+}
+
+template<class Iterator, class UnaryPredicate>
+DiffType<Iterator> countIf(const ThreadPoolExecutor executor, Iterator begin, Iterator end, UnaryPredicate predicate) {
+    if constexpr (PoolCanSplit<Iterator>::value) {
+        if (executor.pool() != nullptr) {
+            using Diff = DiffType<Iterator>;
+            std::atomic<Diff> total{ 0 };
+            forEachBlock(*executor.pool(), static_cast<std::size_t>(end - begin),
+                         [&begin, &predicate, &total](std::size_t, const std::size_t first, const std::size_t last) {
+                             const Diff count =
+                                 std::count_if(begin + static_cast<Diff>(first), begin + static_cast<Diff>(last), predicate);
+                             total.fetch_add(count, std::memory_order_relaxed);
+                         });
+            return total.load();
+        }
+    }
+    return std::count_if(std::move(begin), std::move(end), std::move(predicate));
+}
+
+template<class Iterator, class Compare>
+Iterator minElement(const ThreadPoolExecutor executor, Iterator begin, Iterator end, Compare compare) {
+    if constexpr (PoolCanSplit<Iterator>::value) {
+        if (executor.pool() != nullptr && begin != end) {
+            using Diff = DiffType<Iterator>;
+            ThreadPool& pool = *executor.pool();
+            const auto length = static_cast<std::size_t>(end - begin);
+            std::vector<Iterator> minima(blockCount(pool.size(), length));
+            forEachBlock(pool, length,
+                         [&begin, &compare, &minima](const std::size_t block, const std::size_t first, const std::size_t last) {
+                             minima[block] = std::min_element(begin + static_cast<Diff>(first), begin + static_cast<Diff>(last), compare);
+                         });
+            // Blocks are in order, so the first smallest element is kept, like std::min_element
+            return *std::min_element(minima.begin(), minima.end(),
+                                     [&compare](const Iterator& a, const Iterator& b) { return compare(*a, *b); });
+        }
+    }
+    return std::min_element(std::move(begin), std::move(end), std::move(compare));
+}
+
+template<class Iterator, class Compare>
+Iterator maxElement(const ThreadPoolExecutor executor, Iterator begin, Iterator end, Compare compare) {
+    if constexpr (PoolCanSplit<Iterator>::value) {
+        if (executor.pool() != nullptr && begin != end) {
+            using Diff = DiffType<Iterator>;
+            ThreadPool& pool = *executor.pool();
+            const auto length = static_cast<std::size_t>(end - begin);
+            std::vector<Iterator> maxima(blockCount(pool.size(), length));
+            forEachBlock(pool, length,
+                         [&begin, &compare, &maxima](const std::size_t block, const std::size_t first, const std::size_t last) {
+                             maxima[block] = std::max_element(begin + static_cast<Diff>(first), begin + static_cast<Diff>(last), compare);
+                         });
+            return *std::max_element(maxima.begin(), maxima.end(),
+                                     [&compare](const Iterator& a, const Iterator& b) { return compare(*a, *b); });
+        }
+    }
+    return std::max_element(std::move(begin), std::move(end), std::move(compare));
+}
+
+template<class Iterator, class Compare>
+void sort(const ThreadPoolExecutor executor, Iterator begin, Iterator end, Compare compare) {
+    if constexpr (PoolCanSplit<Iterator>::value) {
+        if (executor.pool() != nullptr) {
+            using Diff = DiffType<Iterator>;
+            ThreadPool& pool = *executor.pool();
+            const auto length = static_cast<std::size_t>(end - begin);
+            const std::size_t blocks = blockCount(pool.size(), length);
+            std::vector<std::size_t> bounds(blocks + 1);
+            bounds[blocks] = length;
+            // Sort every block, then merge adjacent runs pairwise until one run is left. Every block only writes its own begin,
+            // because its end is the begin of the next block
+            forEachBlock(pool, length,
+                         [&begin, &compare, &bounds](const std::size_t block, const std::size_t first, const std::size_t last) {
+                             std::sort(begin + static_cast<Diff>(first), begin + static_cast<Diff>(last), compare);
+                             bounds[block] = first;
+                         });
+            for (std::size_t width = 1; width < blocks; width *= 2) {
+                const std::size_t merges = (blocks + 2 * width - 1) / (2 * width);
+                pool.parallelFor(merges, [&begin, &compare, &bounds, width, blocks](const std::size_t merge) {
+                    const std::size_t left = merge * 2 * width;
+                    const std::size_t middle = left + width;
+                    if (middle >= blocks) {
+                        return;
+                    }
+                    const std::size_t right = middle + width > blocks ? blocks : middle + width;
+                    std::inplace_merge(begin + static_cast<Diff>(bounds[left]), begin + static_cast<Diff>(bounds[middle]),
+                                       begin + static_cast<Diff>(bounds[right]), compare);
+                });
+            }
+            return;
+        }
+    }
+    std::sort(std::move(begin), std::move(end), std::move(compare));
+}
+
+template<class Iterator, class Compare>
+bool isSorted(const ThreadPoolExecutor executor, Iterator begin, Iterator end, Compare compare) {
+    using Ref = RefType<Iterator>;
+    return internal::adjacentFind(executor, begin, end, [&compare](Ref a, Ref b) { return compare(b, a); }) == end;
+}
+
+template<class Iterator, class Compare>
+void nthElement(const ThreadPoolExecutor, Iterator begin, Iterator nth, Iterator end, Compare compare) {
+    // Selection is memory bound and does not split into independent blocks
+    std::nth_element(std::move(begin), std::move(nth), std::move(end), std::move(compare));
+}
+
+template<class IteratorA, class IteratorB, class BinaryPredicate>
+IteratorA search(const ThreadPoolExecutor executor, IteratorA beginA, IteratorA endA, IteratorB beginB, IteratorB endB,
+                 BinaryPredicate predicate) {
+    if constexpr (PoolCanSplit<IteratorA>::value && PoolCanSplit<IteratorB>::value) {
+        const auto lengthA = static_cast<std::size_t>(endA - beginA);
+        const auto lengthB = static_cast<std::size_t>(endB - beginB);
+        if (executor.pool() != nullptr && lengthB != 0 && lengthB <= lengthA) {
+            using Diff = DiffType<IteratorA>;
+            const std::size_t candidates = lengthA - lengthB + 1;
+            const std::size_t index =
+                findFirstIndex(*executor.pool(), candidates, [&beginA, &beginB, &endB, &predicate](const std::size_t i) {
+                    return std::equal(beginB, endB, beginA + static_cast<Diff>(i), predicate);
+                });
+            return index == candidates ? endA : beginA + static_cast<Diff>(index);
+        }
+    }
+    return std::search(std::move(beginA), std::move(endA), std::move(beginB), std::move(endB), std::move(predicate));
+}
+
+template<class IteratorA, class IteratorB, class BinaryPredicate>
+bool equal(const ThreadPoolExecutor executor, IteratorA beginA, IteratorA endA, IteratorB beginB, IteratorB endB,
+           BinaryPredicate predicate) {
+    if constexpr (PoolCanSplit<IteratorA>::value && PoolCanSplit<IteratorB>::value) {
+        if (executor.pool() != nullptr) {
+            const auto length = static_cast<std::size_t>(endA - beginA);
+            if (length != static_cast<std::size_t>(endB - beginB)) {
+                return false;
+            }
+            const std::size_t index = findFirstIndex(*executor.pool(), length, [&beginA, &beginB, &predicate](const std::size_t i) {
+                return !predicate(beginA[static_cast<DiffType<IteratorA>>(i)], beginB[static_cast<DiffType<IteratorB>>(i)]);
+            });
+            return index == length;
+        }
+    }
+    return std::equal(std::move(beginA), std::move(endA), std::move(beginB), std::move(endB), std::move(predicate));
+}
+
+template<class Iterator, class OutputIterator, class UnaryFunc>
+OutputIterator transform(const ThreadPoolExecutor executor, Iterator begin, Iterator end, OutputIterator output, UnaryFunc func) {
+    if constexpr (PoolCanSplit<Iterator>::value && PoolCanSplit<OutputIterator>::value) {
+        if (executor.pool() != nullptr) {
+            using Diff = DiffType<Iterator>;
+            using OutDiff = DiffType<OutputIterator>;
+            ThreadPool& pool = *executor.pool();
+            const auto length = static_cast<std::size_t>(end - begin);
+            const std::size_t blocks = blockCount(pool.size(), length, cacheBlockSize<ValueType<Iterator>>(), 64);
+            forEachBlock(pool, length, blocks,
+                         [&begin, &output, &func](std::size_t, const std::size_t first, const std::size_t last) {
+                             std::transform(begin + static_cast<Diff>(first), begin + static_cast<Diff>(last),
+                                            output + static_cast<OutDiff>(first), func);
+                         });
+            return output + static_cast<OutDiff>(length);
+        }
+    }
+    return std::transform(std::move(begin), std::move(end), std::move(output), std::move(func));
+}
+
+template<class Iterator, class OutputIterator>
+OutputIterator copy(const ThreadPoolExecutor executor, Iterator begin, Iterator end, OutputIterator output) {
+    using Ref = RefType<Iterator>;
+    return internal::transform(executor, std::move(begin), std::move(end), std::move(output),
+                               [](Ref value) -> Ref { return std::forward<Ref>(value); });
+}
+
+template<class Func>
+void parallelForEachBlock(const ThreadPoolExecutor executor, const std::size_t length, const std::size_t blocks, Func func) {
+    if (executor.pool() != nullptr) {
+        forEachBlock(*executor.pool(), length, blocks, std::move(func));
+        return;
+    }
+    for (std::size_t block = 0; block < blocks; ++block) {
+        callWithBlockBounds(func, length, blocks, block);
+    }
+}
+
+inline std::size_t threadCount(const ThreadPoolExecutor executor) {
+    return executor.pool() == nullptr ? 1 : executor.pool()->size();
+}
+} // namespace internal
+#    endif // LZ_HAS_EXECUTION
+} // namespace lz
+
+#endif // LZ_THREAD_POOL_HPP
@@ -0,0 +1,175 @@
+#pragma once
+
+#ifndef LZ_TO_CHARS_HPP
+#define LZ_TO_CHARS_HPP
+
+#include "LzTools.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <sstream>
+#include <string>
+
+#if defined(LZ_HAS_CXX_17) && LZ_HAS_INCLUDE(<charconv>)
+#    include <charconv>
+#    define LZ_HAS_TO_CHARS
+#    if defined(__cpp_lib_to_chars)
+#        define LZ_HAS_TO_CHARS_FLOAT
+#    endif // __cpp_lib_to_chars
+#endif // LZ_HAS_CXX_17 && <charconv>
+
+namespace lz {
+namespace internal {
+constexpr std::size_t countDigits(const std::size_t value) noexcept {
+    return value < 10 ? 1 : 1 + countDigits(value / 10);
+}
+
+// The longest shortest round trip representation: a sign, the digits, a point and an exponent (denormals included)
+template<class T>
+constexpr std::size_t maxCharsSpecialized(std::true_type /* isFloatingPoint */) noexcept {
+    return 1 + static_cast<std::size_t>(std::numeric_limits<T>::max_digits10) + 1 + 2 +
+           countDigits(static_cast<std::size_t>(-std::numeric_limits<T>::min_exponent10 + std::numeric_limits<T>::max_digits10));
+}
+
+template<class T>
+constexpr std::size_t maxCharsSpecialized(std::false_type /* isFloatingPoint */) noexcept {
+    return std::is_same<T, bool>::value   ? 5
+           : std::is_same<T, char>::value ? 1
+                                          : static_cast<std::size_t>(std::numeric_limits<T>::digits10) + 1 +
+                                                static_cast<std::size_t>(std::numeric_limits<T>::is_signed);
+}
+
+// The maximum amount of characters that `appendChars` appends for an arithmetic type
+template<class T>
+constexpr std::size_t maxChars() noexcept {
+    return maxCharsSpecialized<T>(std::is_floating_point<T>());
+}
+
+#ifdef LZ_HAS_TO_CHARS
+// Writes the value straight into `out`, after growing it by the maximum length of `T`
+template<class T>
+void appendToChars(std::string& out, const T value) {
+    const std::size_t size = out.size();
+    out.resize(size + maxChars<T>());
+    char* first = &out[size];
+    const std::to_chars_result result = std::to_chars(first, first + maxChars<T>(), value);
+    out.resize(static_cast<std::size_t>(result.ptr - out.data()));
+}
+
+template<class T>
+void appendNumber(std::string& out, const T value, std::false_type /* isFloatingPoint */) {
+    appendToChars(out, value);
+}
+#else
+template<class T>
+void appendNumber(std::string& out, const T value, std::false_type /* isFloatingPoint */) {
+    using Unsigned = typename std::make_unsigned<T>::type;
+    const bool negative = value < 0;
+    // Negated as unsigned, so that the minimum value doesn't overflow
+    Unsigned magnitude = negative ? static_cast<Unsigned>(0u - static_cast<Unsigned>(value)) : static_cast<Unsigned>(value);
+    char buffer[maxChars<T>()];
+    char* first = buffer + sizeof buffer;
+    do {
+        *--first = static_cast<char>('0' + magnitude % 10);
+        magnitude = static_cast<Unsigned>(magnitude / 10);
+    } while (magnitude != 0);
+    if (negative) {
+        *--first = '-';
+    }
+    out.append(first, buffer + sizeof buffer);
+}
+#endif // LZ_HAS_TO_CHARS
+
+#ifdef LZ_HAS_TO_CHARS_FLOAT
+template<class T>
+void appendNumber(std::string& out, const T value, std::true_type /* isFloatingPoint */) {
+    // Without a format or precision, the shortest representation that round trips is written
+    appendToChars(out, value);
+}
+#else
+inline int formatFloat(char* buffer, const std::size_t size, const int precision, const float value) {
+    return std::snprintf(buffer, size, "%.*g", precision, static_cast<double>(value));
+}
+
+inline int formatFloat(char* buffer, const std::size_t size, const int precision, const double value) {
+    return std::snprintf(buffer, size, "%.*g", precision, value);
+}
+
+inline int formatFloat(char* buffer, const std::size_t size, const int precision, const long double value) {
+    return std::snprintf(buffer, size, "%.*Lg", precision, value);
+}
+
+inline void parseFloat(const char* buffer, float& value) {
+    value = std::strtof(buffer, nullptr);
+}
+
+inline void parseFloat(const char* buffer, double& value) {
+    value = std::strtod(buffer, nullptr);
+}
+
+inline void parseFloat(const char* buffer, long double& value) {
+    value = std::strtold(buffer, nullptr);
+}
+
+// The precision is increased until the value round trips, so that the shortest representation is written. `%g` removes trailing
+// zeros, so every normal value with a shorter representation than `digits10` digits round trips at the first try
+template<class T>
+void appendNumber(std::string& out, const T value, std::true_type /* isFloatingPoint */) {
+    char buffer[maxChars<T>() + 1];
+    int length = 0;
+    int precision = std::fpclassify(value) == FP_SUBNORMAL ? 1 : std::numeric_limits<T>::digits10;
+    for (; precision <= std::numeric_limits<T>::max_digits10; ++precision) {
+        length = formatFloat(buffer, sizeof buffer, precision, value);
+        T parsed{};
+        parseFloat(buffer, parsed);
+        if (parsed == value || value != value) {
+            break;
+        }
+    }
+    out.append(buffer, static_cast<std::size_t>(length));
+}
+#endif // LZ_HAS_TO_CHARS_FLOAT
+
+/**
+ * Appends an arithmetic value to `out`, using `std::to_chars` if available. Floating points are written in their shortest form
+ * that round trips, `bool`s as `true` or `false` and `char`s as is.
+ */
+template<class T>
+void appendChars(std::string& out, const T value) {
+    appendNumber(out, value, std::is_floating_point<T>());
+}
+
+inline void appendChars(std::string& out, const bool value) {
+    out += value ? "true" : "false";
+}
+
+inline void appendChars(std::string& out, const char value) {
+    out += value;
+}
+
+template<class T>
+using IsAppendable = std::integral_constant<bool, std::is_arithmetic<T>::value || std::is_convertible<const T&, StringView>::value>;
+
+// Appends `value` to `out`. Arithmetic values and strings are appended directly, other types using their `operator<<`
+template<class T>
+EnableIf<std::is_arithmetic<T>::value> appendValue(std::string& out, const T value) {
+    appendChars(out, value);
+}
+
+template<class T>
+EnableIf<!std::is_arithmetic<T>::value && IsAppendable<T>::value> appendValue(std::string& out, const T& value) {
+    out += value;
+}
+
+template<class T>
+EnableIf<!IsAppendable<T>::value> appendValue(std::string& out, const T& value) {
+    std::ostringstream oss;
+    oss << value;
+    out += oss.str();
+}
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_TO_CHARS_HPP
@@ -5,6 +5,7 @@
 
 #include "FunctionContainer.hpp"
 #include "LzTools.hpp"
+#include "ParallelAlgorithms.hpp"
 
 #include <algorithm>
 
@@ -64,7 +65,7 @@ public:
             _iterator = std::adjacent_find(std::move(_iterator), _end, _compare);
         }
         else {
-            _iterator = std::adjacent_find(_execution, std::move(_iterator), _end, _compare);
+            _iterator = internal::adjacentFind(_execution, std::move(_iterator), _end, _compare);
         }
 #else  // ^^^ lz has execution vvv ! lz has execution
         _iterator = std::adjacent_find(std::move(_iterator), _end, _compare);
@@ -89,6 +90,10 @@ public:
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator==(const UniqueIterator& a, const UniqueIterator& b) {
         return !(a != b); // NOLINT
     }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend SizeHint sizeHint(const UniqueIterator& begin, const UniqueIterator& end) {
+        return { begin != end ? 1u : 0u, getSizeHint(begin._iterator, end._iterator).upper };
+    }
 };
 } // namespace internal
 } // namespace lz
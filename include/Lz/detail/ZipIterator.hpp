@@ -50,6 +50,41 @@ private:
         plusIs(is, -differenceType);
     }
 
+    template<class UnaryFunc, std::size_t... I>
+    LZ_CONSTEXPR_CXX_20 bool
+    forEachUntilImpl(const ZipIterator& end, UnaryFunc& func, IndexSequence<I...>, std::random_access_iterator_tag) {
+        // Index based, so that only one counter is compared per element instead of every iterator
+        const difference_type length = end - *this;
+        for (difference_type i = 0; i < length; ++i) {
+            if (func(reference{ std::get<I>(_iterators)[i]... })) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template<class UnaryFunc, std::size_t... I>
+    LZ_CONSTEXPR_CXX_20 bool
+    forEachUntilImpl(const ZipIterator& end, UnaryFunc& func, IndexSequence<I...>, std::input_iterator_tag) {
+        for (; *this != end; ++*this) {
+            if (func(**this)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template<std::size_t... I>
+    LZ_CONSTEXPR_CXX_20 SizeHint sizeHintImpl(const ZipIterator& end, IndexSequence<I...>) const {
+        const SizeHint hints[] = { getSizeHint(std::get<I>(_iterators), std::get<I>(end._iterators))... };
+        SizeHint result = hints[0];
+        for (const SizeHint& hint : hints) {
+            result.lower = hint.lower < result.lower ? hint.lower : result.lower;
+            result.upper = hint.upper < result.upper ? hint.upper : result.upper;
+        }
+        return result;
+    }
+
 public:
     LZ_CONSTEXPR_CXX_20 explicit ZipIterator(std::tuple<Iterators...> iterators) : _iterators(std::move(iterators)) {
     }
@@ -109,7 +144,8 @@ public:
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 difference_type operator-(const ZipIterator& other) const {
-        return std::get<0>(_iterators) - std::get<0>(other._iterators);
+        // The end iterator is trimmed to the shortest sequence in Zip, so the length of the first is the length of all
+        return getIterLength(std::get<0>(other._iterators), std::get<0>(_iterators));
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator[](const difference_type offset) const {
@@ -139,8 +175,32 @@ public:
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator>=(const ZipIterator& a, const ZipIterator& b) {
         return !(a < b); // NOLINT
     }
+
+    template<class UnaryFunc>
+    LZ_CONSTEXPR_CXX_20 friend bool forEachUntil(ZipIterator begin, ZipIterator end, UnaryFunc&& func) {
+        return begin.forEachUntilImpl(end, func, MakeIndexSequenceForThis(), iterator_category());
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend SizeHint sizeHint(const ZipIterator& begin, const ZipIterator& end) {
+        return begin.sizeHintImpl(end, MakeIndexSequenceForThis());
+    }
 };
+
+template<class... Iterators>
+struct IsSized<ZipIterator<Iterators...>> : IsSized<TupleElement<0, std::tuple<Iterators...>>> {};
 } // namespace internal
+
+/**
+ * Gets the distance between begin and end. If the first underlying iterator type is sized, this is O(1).
+ * @param begin Beginning of the sequence.
+ * @param end Ending of the sequence.
+ * @return The length of the sequence.
+ */
+template<LZ_CONCEPT_ITERATOR... Iterators>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 typename internal::ZipIterator<Iterators...>::difference_type
+distance(const internal::ZipIterator<Iterators...>& begin, const internal::ZipIterator<Iterators...>& end) {
+    return end - begin;
+}
 } // namespace lz
 
 #endif
\ No newline at end of file
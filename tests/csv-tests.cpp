@@ -0,0 +1,95 @@
+#include <Lz/Lz.hpp>
+#include <Lz/MappedFile.hpp>
+#include <catch2/catch.hpp>
+#include <cstdio>
+#include <fstream>
+
+namespace {
+template<class Iterable>
+std::vector<std::string> toStrings(const Iterable& iterable) {
+    std::vector<std::string> result;
+    for (auto&& str : iterable) {
+        result.emplace_back(str.data(), str.size());
+    }
+    return result;
+}
+} // namespace
+
+TEST_CASE("Csv changing and creating elements", "[Csv][Basic functionality]") {
+    const std::string csv = "name,quote\r\nJohn,\"Hello, \"\"world\"\"\"\nJane,\"two\nlines\"\n";
+
+    SECTION("Should split records on unquoted line feeds") {
+        CHECK(toStrings(lz::csvRecords(csv)) ==
+              std::vector<std::string>{ "name,quote", "John,\"Hello, \"\"world\"\"\"", "Jane,\"two\nlines\"" });
+    }
+
+    SECTION("Should split fields on unquoted delimiters and unescape quotes") {
+        std::vector<std::vector<std::string>> fields;
+        for (auto record : lz::csvRecords(csv)) {
+            fields.push_back(toStrings(lz::csvFields(record)));
+        }
+        CHECK(fields == std::vector<std::vector<std::string>>{
+                            { "name", "quote" }, { "John", "Hello, \"world\"" }, { "Jane", "two\nlines" } });
+    }
+
+    SECTION("Should not copy fields without escaped quotes") {
+        const std::string record = "a,\"b,c\"";
+        auto fields = lz::csvFields(record);
+        auto it = fields.begin();
+        CHECK((*it).data() == record.data());
+        ++it;
+        CHECK((*it).data() == record.data() + 3);
+    }
+
+    SECTION("Should copy fields when collecting") {
+        const std::string record = "\"a\"\"b\",\"c\"\"d\",x";
+        CHECK(lz::csvFields(record).toVector() == std::vector<std::string>{ "a\"b", "c\"d", "x" });
+    }
+}
+
+TEST_CASE("Csv empty fields and records", "[Csv][Empty]") {
+    const std::string empty;
+    CHECK(toStrings(lz::csvRecords(empty)).empty());
+    CHECK(toStrings(lz::csvFields(empty)).empty());
+
+    const std::string record = ",a,,\"\",";
+    CHECK(toStrings(lz::csvFields(record)) == std::vector<std::string>{ "", "a", "", "", "" });
+
+    const std::string records = "a\n\nb";
+    CHECK(toStrings(lz::csvRecords(records)) == std::vector<std::string>{ "a", "", "b" });
+}
+
+TEST_CASE("Csv long records", "[Csv][Blocks]") {
+    // Quoted sections that cross the blocks of 64 characters that are classified at once
+    std::string csv;
+    std::vector<std::vector<std::string>> expected;
+    for (int i = 0; i < 50; ++i) {
+        const std::string quoted(static_cast<std::size_t>(i * 7 % 150), i % 2 == 0 ? ';' : '\n');
+        expected.push_back({ std::to_string(i), quoted + "\"", "x" });
+        csv += std::to_string(i) + ";\"" + quoted + "\"\"\";x\n";
+    }
+    std::vector<std::vector<std::string>> fields;
+    for (auto record : lz::csvRecords(csv)) {
+        fields.push_back(toStrings(lz::csvFields(record, ';')));
+    }
+    CHECK(fields == expected);
+}
+
+#ifdef LZ_HAS_MAPPED_FILE
+TEST_CASE("Csv from a mapped file", "[Csv][Mapped file]") {
+    const std::string path = "lz-csv-test.csv";
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << "1,\"a\"\r\n2,\"b\"\"\"\r\n";
+    }
+    {
+        const lz::MappedFile file = lz::mmapFile(path);
+        std::vector<std::string> last;
+        for (auto record : lz::csvRecords(file)) {
+            last.push_back(toStrings(lz::csvFields(record)).back());
+        }
+        CHECK(last == std::vector<std::string>{ "a", "b\"" });
+    }
+    std::remove(path.c_str());
+}
+#endif // LZ_HAS_MAPPED_FILE
@@ -102,3 +102,55 @@ TEST_CASE("Except to containers", "[Except][To container]") {
         CHECK(actual == expected);
     }
 }
+
+namespace {
+struct Unhashable {
+    int value;
+
+    bool operator<(const Unhashable& other) const {
+        return value < other.value;
+    }
+
+    bool operator==(const Unhashable& other) const {
+        return value == other.value;
+    }
+};
+
+std::vector<Unhashable> toUnhashable(const std::vector<int>& values) {
+    std::vector<Unhashable> result;
+    for (int i : values) {
+        result.push_back(Unhashable{ i });
+    }
+    return result;
+}
+} // namespace
+
+TEST_CASE("Except lookup strategies", "[Except][Strategies]") {
+    std::vector<int> toExcept{ 1, 1, 4, 6, 7, 7, 10, 15, 20, 21 };
+    std::vector<int> sorted{ 0, 1, 1, 2, 4, 5, 7, 8, 9, 10, 15, 16, 21, 22 };
+    std::vector<int> unsorted{ 21, 0, 7, 3, 1, 22, 15, 4, 4, 9, 1, 30 };
+
+    std::vector<int> sortedExpected{ 0, 2, 5, 8, 9, 16, 22 };
+    std::vector<int> unsortedExpected{ 0, 3, 22, 9, 30 };
+
+    SECTION("Hash set") {
+        CHECK(lz::except(sorted, toExcept).toVector() == sortedExpected);
+        CHECK(lz::except(unsorted, toExcept).toVector() == unsortedExpected);
+    }
+
+    SECTION("Merge cursor") {
+        auto exceptUnhashable = toUnhashable(toExcept);
+        auto sortedUnhashable = toUnhashable(sorted);
+        auto unsortedUnhashable = toUnhashable(unsorted);
+        CHECK(lz::except(sortedUnhashable, exceptUnhashable).toVector() == toUnhashable(sortedExpected));
+        CHECK(lz::except(unsortedUnhashable, exceptUnhashable).toVector() == toUnhashable(unsortedExpected));
+    }
+
+    SECTION("Merge cursor with custom comparer and forward iterators") {
+        std::list<int> descending(toExcept.rbegin(), toExcept.rend());
+        std::vector<int> input(sorted.rbegin(), sorted.rend());
+        input.insert(input.end(), unsorted.begin(), unsorted.end());
+        std::vector<int> expected{ 22, 16, 9, 8, 5, 2, 0, 0, 3, 22, 9, 30 };
+        CHECK(lz::except(input, descending, std::greater<int>()).toVector() == expected);
+    }
+}
@@ -0,0 +1,93 @@
+#include <Lz/FileDescriptor.hpp>
+#include <Lz/Lz.hpp>
+#include <catch2/catch.hpp>
+#include <cstdio>
+#include <sstream>
+
+#ifndef _WIN32
+#    include <unistd.h>
+#endif // _WIN32
+
+TEST_CASE("Format to output iterators and buffers", "[Format to][Basic functionality]") {
+    std::vector<int> vec = { 1, 2, 3, 4, 5 };
+
+    SECTION("Should append to an output iterator") {
+        std::string result = "values: ";
+        lz::toIter(vec).formatTo(std::back_inserter(result), ", ");
+        CHECK(result == "values: 1, 2, 3, 4, 5");
+
+        std::vector<char> chars;
+        lz::toIter(vec).formatTo(std::back_inserter(chars), "-", "{:02}");
+        CHECK(std::string(chars.begin(), chars.end()) == "01-02-03-04-05");
+    }
+
+    SECTION("Should return the end of the output") {
+        std::array<char, 16> chars{};
+        const auto end = lz::toIter(vec).formatTo(chars.begin(), ",");
+        CHECK(std::string(chars.begin(), end) == "1,2,3,4,5");
+    }
+
+    SECTION("Should append to a memory buffer") {
+        fmt::memory_buffer buffer;
+        lz::toIter(vec).formatTo(buffer, " ");
+        lz::toIter(vec).formatTo(buffer, "", "[{}]");
+        CHECK(fmt::to_string(buffer) == "1 2 3 4 5[1][2][3][4][5]");
+    }
+
+    SECTION("Should write nothing for an empty view") {
+        std::string result;
+        lz::range(0).formatTo(std::back_inserter(result), ", ");
+        fmt::memory_buffer buffer;
+        lz::range(0).formatTo(buffer, ", ");
+        CHECK(result.empty());
+        CHECK(buffer.size() == 0);
+    }
+
+    SECTION("Should equal toString for outputs larger than the buffer") {
+        auto range = lz::range(10000);
+        std::string result;
+        range.formatTo(std::back_inserter(result), ", ");
+        CHECK(result == range.toString(", "));
+    }
+}
+
+TEST_CASE("Write to streams and files", "[Format to][Write to]") {
+    auto range = lz::range(1000);
+    const std::string expected = range.toString(" ");
+
+    SECTION("Should write to an ostream") {
+        std::ostringstream stream;
+        range.writeTo(stream, " ", "{}", 7);
+        CHECK(stream.str() == expected);
+
+        std::ostringstream streamed;
+        streamed << range;
+        CHECK(streamed.str() == expected);
+    }
+
+    SECTION("Should write to a FILE") {
+        std::FILE* file = std::tmpfile();
+        REQUIRE(file != nullptr);
+        range.writeTo(file, " ", "{}", 64);
+        std::rewind(file);
+        std::string result(expected.size() + 1, '\0');
+        result.resize(std::fread(&result[0], 1, result.size(), file));
+        std::fclose(file);
+        CHECK(result == expected);
+    }
+}
+
+#ifndef _WIN32
+TEST_CASE("Write to file descriptor", "[Format to][File descriptor]") {
+    int fds[2];
+    REQUIRE(::pipe(fds) == 0);
+    lz::range(5).writeTo(fds[1], ", ", "{}", 4);
+    ::close(fds[1]);
+
+    auto written = lz::fromFd(fds[0]);
+    CHECK(std::string(written.begin(), written.end()) == "0, 1, 2, 3, 4");
+    ::close(fds[0]);
+
+    CHECK_THROWS_AS(lz::range(5).writeTo(-1), std::system_error);
+}
+#endif // _WIN32
@@ -0,0 +1,109 @@
+#include <Lz/HashJoin.hpp>
+#include <catch2/catch.hpp>
+#include <list>
+
+namespace {
+struct Customer {
+    int id;
+};
+
+struct PaymentBill {
+    int customerId;
+    int id;
+};
+} // namespace
+
+TEST_CASE("Hash join basic functionality", "[HashJoin][Basic functionality]") {
+    std::vector<Customer> customers{
+        Customer{ 25 }, Customer{ 1 }, Customer{ 39 }, Customer{ 103 }, Customer{ 99 },
+    };
+    std::vector<PaymentBill> paymentBills{
+        PaymentBill{ 99, 1 }, PaymentBill{ 25, 0 },    PaymentBill{ 2523, 52 },
+        PaymentBill{ 25, 2 }, PaymentBill{ 2523, 53 }, PaymentBill{ 25, 3 },
+    };
+
+    auto joined = lz::hashJoin(
+        customers, paymentBills, [](const Customer& c) { return c.id; }, [](const PaymentBill& p) { return p.customerId; },
+        [](const Customer& c, const PaymentBill& p) { return std::make_pair(c.id, p.id); });
+
+    SECTION("Should find all matches, in the order of the larger, probed sequence") {
+        std::vector<std::pair<int, int>> expected = { { 99, 1 }, { 25, 0 }, { 25, 2 }, { 25, 3 } };
+        CHECK(joined.toVector() == expected);
+    }
+
+    SECTION("Operator== & operator!=") {
+        auto it = joined.begin();
+        CHECK(it != joined.end());
+        CHECK(std::distance(joined.begin(), joined.end()) == 4);
+        it = joined.end();
+        CHECK(it == joined.end());
+    }
+
+    SECTION("Unsorted sequences without matches") {
+        std::vector<PaymentBill> other{ PaymentBill{ 2, 1 }, PaymentBill{ 3, 1 } };
+        auto none = lz::hashJoin(
+            customers, other, [](const Customer& c) { return c.id; }, [](const PaymentBill& p) { return p.customerId; },
+            [](const Customer& c, const PaymentBill& p) { return std::make_pair(c.id, p.id); });
+        CHECK(none.begin() == none.end());
+    }
+}
+
+TEST_CASE("Hash join duplicates and orientation", "[HashJoin][Duplicates]") {
+    std::vector<int> small{ 3, 1, 3 };
+    std::vector<int> large{ 1, 2, 3, 4, 3, 5, 1 };
+    const auto identity = [](int i) { return i; };
+    const auto pair = [](int a, int b) { return std::make_pair(a, b); };
+
+    SECTION("Table over the smaller first sequence, results ordered by the second") {
+        auto joined = lz::hashJoin(small, large, identity, identity, pair);
+        std::vector<std::pair<int, int>> expected = { { 1, 1 }, { 3, 3 }, { 3, 3 }, { 3, 3 }, { 3, 3 }, { 1, 1 } };
+        CHECK(joined.toVector() == expected);
+    }
+
+    SECTION("Table over the second sequence, results ordered by the first") {
+        auto joined = lz::hashJoin(large, small, identity, identity, pair);
+        std::vector<std::pair<int, int>> expected = { { 1, 1 }, { 3, 3 }, { 3, 3 }, { 3, 3 }, { 3, 3 }, { 1, 1 } };
+        CHECK(joined.toVector() == expected);
+    }
+
+    SECTION("Unsized sequences and many keys") {
+        std::list<int> a;
+        std::vector<int> b;
+        for (int i = 0; i < 1000; ++i) {
+            a.push_back(i % 300);
+            b.push_back(i * 3);
+        }
+        auto joined = lz::hashJoin(a, b, identity, identity, pair);
+        std::size_t count = 0;
+        for (const auto& p : joined) {
+            CHECK(p.first == p.second);
+            ++count;
+        }
+        // 0, 3, ..., 297 are each present 3 or 4 times in `a`
+        CHECK(count == static_cast<std::size_t>(std::count_if(a.begin(), a.end(), [](int i) { return i % 3 == 0; })));
+    }
+}
+
+TEST_CASE("Left hash join", "[HashJoin][Left outer]") {
+    std::vector<Customer> customers{
+        Customer{ 25 }, Customer{ 1 }, Customer{ 99 },
+    };
+    std::vector<PaymentBill> paymentBills{
+        PaymentBill{ 99, 1 },
+        PaymentBill{ 25, 0 },
+        PaymentBill{ 25, 2 },
+    };
+
+    auto joined = lz::leftHashJoin(
+        customers, paymentBills, [](const Customer& c) { return c.id; }, [](const PaymentBill& p) { return p.customerId; },
+        [](const Customer& c, const PaymentBill* p) { return std::make_pair(c.id, p ? p->id : -1); });
+
+    std::vector<std::pair<int, int>> expected = { { 25, 0 }, { 25, 2 }, { 1, -1 }, { 99, 1 } };
+    CHECK(joined.toVector() == expected);
+
+    std::vector<PaymentBill> empty;
+    auto allMissing = lz::leftHashJoin(
+        customers, empty, [](const Customer& c) { return c.id; }, [](const PaymentBill& p) { return p.customerId; },
+        [](const Customer& c, const PaymentBill* p) { return std::make_pair(c.id, p ? p->id : -1); });
+    CHECK(allMissing.toVector() == std::vector<std::pair<int, int>>{ { 25, -1 }, { 1, -1 }, { 99, -1 } });
+}
@@ -0,0 +1,146 @@
+#include <Lz/FileDescriptor.hpp>
+#include <Lz/InputStream.hpp>
+#include <Lz/Lz.hpp>
+#include <catch2/catch.hpp>
+#include <sstream>
+#include <streambuf>
+
+#ifndef _WIN32
+#    include <unistd.h>
+#endif // _WIN32
+
+// Delivers its chunks one at a time, like a pipe that receives them separately
+class ChunkedBuffer : public std::streambuf {
+    std::vector<std::string> _chunks;
+    std::size_t _next{};
+
+public:
+    explicit ChunkedBuffer(std::vector<std::string> chunks) : _chunks(std::move(chunks)) {
+    }
+
+    std::size_t delivered() const {
+        return _next;
+    }
+
+protected:
+    int_type underflow() override {
+        if (_next == _chunks.size()) {
+            return traits_type::eof();
+        }
+        std::string& chunk = _chunks[_next++];
+        setg(&chunk[0], &chunk[0], &chunk[0] + chunk.size());
+        return traits_type::to_int_type(chunk[0]);
+    }
+};
+
+TEST_CASE("Input stream changing and creating elements", "[Input stream][Basic functionality]") {
+    std::istringstream stream("hello world");
+    auto view = lz::fromStream(stream, 4);
+
+    SECTION("Should read every character") {
+        CHECK(std::string(view.begin(), view.end()) == "hello world");
+    }
+
+    SECTION("Should share the buffer between copies") {
+        auto begin = view.begin();
+        auto copy = begin;
+        CHECK(*begin == 'h');
+        ++begin;
+        CHECK(*copy == 'e');
+    }
+}
+
+TEST_CASE("Input stream binary operations", "[Input stream][Binary ops]") {
+    std::istringstream stream("ab");
+    auto view = lz::fromStream(stream);
+    auto begin = view.begin();
+
+    CHECK(begin != view.end());
+    ++begin;
+    CHECK(begin != view.end());
+    ++begin;
+    CHECK(begin == view.end());
+
+    std::istringstream empty;
+    auto emptyView = lz::fromStream(empty);
+    CHECK(emptyView.begin() == emptyView.end());
+}
+
+TEST_CASE("Input stream lines", "[Input stream][Lines]") {
+    SECTION("Carriage returns and no trailing line feed") {
+        std::istringstream stream("hello\r\nworld\n\nlast");
+        CHECK(lz::fromStream(stream).lines<std::string>().toVector() == std::vector<std::string>{ "hello", "world", "", "last" });
+    }
+
+    SECTION("Trailing line feed") {
+        std::istringstream stream("hello\n");
+        CHECK(lz::fromStream(stream).lines<std::string>().toVector() == std::vector<std::string>{ "hello" });
+    }
+
+    SECTION("Lines longer than the buffer") {
+        std::string contents;
+        std::vector<std::string> expected;
+        for (int i = 0; i < 200; ++i) {
+            expected.push_back(std::string(static_cast<std::size_t>(i % 37), 'x') + std::to_string(i));
+            contents += expected.back() + (i % 3 == 0 ? "\r\n" : "\n");
+        }
+        for (const std::size_t bufferSize : { 1, 7, 64, 65536 }) {
+            std::istringstream stream(contents);
+            CHECK(lz::fromStream(stream, bufferSize).lines<std::string>().toVector() == expected);
+        }
+    }
+
+    SECTION("Collected string views should own their characters") {
+        std::istringstream stream("first line\nsecond line\nthird line");
+        auto lines = lz::fromStream(stream, 8).lines();
+        static_assert(std::is_same<decltype(*lines.begin()), lz::StringView>::value, "lines should be string views by default");
+        CHECK(lines.toVector() == std::vector<std::string>{ "first line", "second line", "third line" });
+    }
+
+    SECTION("Should return lines as soon as they are available") {
+        ChunkedBuffer buffer({ "first\n", "second\n" });
+        std::istream stream(&buffer);
+        auto lines = lz::fromStream(stream).lines();
+        auto begin = lines.begin();
+        CHECK(*begin == "first");
+        CHECK(buffer.delivered() == 1);
+        ++begin;
+        CHECK(*begin == "second");
+        CHECK(buffer.delivered() == 2);
+    }
+
+    SECTION("Should continue after the characters that have been read") {
+        std::istringstream stream("#header\nfirst\nsecond");
+        auto view = lz::fromStream(stream, 4);
+        auto begin = view.begin();
+        while (*begin != '\n') {
+            ++begin;
+        }
+        ++begin;
+        CHECK(view.lines<std::string>().toVector() == std::vector<std::string>{ "first", "second" });
+    }
+
+    SECTION("Should compose with IterView") {
+        std::istringstream stream("1\n22\n333\n4444");
+        const auto lengths = lz::toIter(lz::fromStream(stream).lines<std::string>())
+                                 .filter([](const std::string& line) { return line.size() % 2 == 0; })
+                                 .map([](const std::string& line) { return line.size(); })
+                                 .toVector();
+        CHECK(lengths == std::vector<std::size_t>{ 2, 4 });
+    }
+}
+
+#ifndef _WIN32
+TEST_CASE("Input stream from file descriptor", "[Input stream][File descriptor]") {
+    int fds[2];
+    REQUIRE(::pipe(fds) == 0);
+    const std::string contents = "first\nsecond\r\nthird";
+    REQUIRE(::write(fds[1], contents.data(), contents.size()) == static_cast<ssize_t>(contents.size()));
+    ::close(fds[1]);
+
+    CHECK(lz::fromFd(fds[0], 5).lines<std::string>().toVector() == std::vector<std::string>{ "first", "second", "third" });
+    ::close(fds[0]);
+
+    CHECK_THROWS_AS(lz::fromFd(-1).toVector(), std::system_error);
+}
+#endif // _WIN32
@@ -1,5 +1,6 @@
 #include <Lz/Join.hpp>
 #include <Lz/Map.hpp>
+#include <Lz/Range.hpp>
 #include <catch2/catch.hpp>
 #include <sstream>
 
@@ -22,8 +23,19 @@ TEST_CASE("Join should convert to string", "[Join][Basic functionality]") {
     }
 
     SECTION("Type checking") {
-        CHECK(std::is_same<decltype(*joinStr.begin()), std::string&>::value);
-        CHECK(std::is_same<decltype(*joinInt.begin()), std::string>::value);
+        CHECK(std::is_same<decltype(*joinStr.begin()), lz::StringView>::value);
+        CHECK(std::is_same<decltype(*joinInt.begin()), lz::StringView>::value);
+        CHECK(std::is_same<decltype(joinInt.toVector()), std::vector<std::string>>::value);
+    }
+
+    SECTION("Should share the delimiter and reuse the buffer") {
+        std::vector<int> large = { 1234567890, 2, 1234567890 };
+        const std::string delimiter = ", a delimiter that does not fit in a small string";
+        auto joinLarge = lz::join(large, delimiter);
+        CHECK(joinLarge.toVector() == std::vector<std::string>{ "1234567890", delimiter, "2", delimiter, "1234567890" });
+        const auto first = joinLarge.begin() + 1;
+        const auto second = joinLarge.begin() + 3;
+        CHECK((*first).data() == (*second).data());
     }
 
     SECTION("Should be correct size") {
@@ -143,4 +155,12 @@ TEST_CASE("Join binary operations", "[Join][Binary ops]") {
         auto doubles = lz::strJoin(vec, ", ", "{:.2f}");
         CHECK(doubles == "1.10, 2.20, 3.30, 4.40");
     }
+
+    SECTION("String join compiled format") {
+        std::array<double, 4> vec = {1.1, 2.2, 3.3, 4.4};
+        CHECK(lz::strJoin(vec, ", ", FMT_COMPILE("{:.2f}")) == "1.10, 2.20, 3.30, 4.40");
+        CHECK(lz::strJoinRange(vec.begin(), vec.end(), "", FMT_COMPILE("[{}]")) == "[1.1][2.2][3.3][4.4]");
+        CHECK(lz::range(4).toString(", ", FMT_COMPILE("{:02}")) == "00, 01, 02, 03");
+        CHECK(lz::range(0).toString(", ", FMT_COMPILE("{:02}")).empty());
+    }
 }
@@ -163,4 +163,48 @@ TEST_CASE("JoinWhere to containers", "[JoinWhere][To container]") {
                    std::get<1>(a.second).customerId == std::get<1>(b.second).customerId;
         }));
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Join where with sorted and unsorted keys", "[JoinWhere][Merge join]") {
+    const auto identity = [](int i) {
+        return i;
+    };
+    const auto pair = [](int a, int b) {
+        return std::make_pair(a, b);
+    };
+    using Pairs = std::vector<std::pair<int, int>>;
+    std::vector<int> b{ 1, 1, 2, 4, 4, 4, 7, 9, 9, 12, 15, 15, 20 };
+
+    SECTION("Sorted keys with duplicates on both sides") {
+        std::vector<int> a{ 0, 1, 1, 3, 4, 4, 9, 10, 15, 20, 20, 21 };
+        Pairs expected = { { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 4, 4 }, { 4, 4 }, { 4, 4 }, { 4, 4 }, { 4, 4 }, { 4, 4 },
+                           { 9, 9 }, { 9, 9 }, { 15, 15 }, { 15, 15 }, { 20, 20 }, { 20, 20 } };
+        CHECK(lz::joinWhere(a, b, identity, identity, pair).toVector() == expected);
+    }
+
+    SECTION("Unsorted keys") {
+        std::vector<int> a{ 20, 4, 1, 15, 4, 0, 9, 1, 21, 12 };
+        Pairs expected = { { 20, 20 }, { 4, 4 }, { 4, 4 }, { 4, 4 }, { 1, 1 }, { 1, 1 }, { 15, 15 }, { 15, 15 }, { 4, 4 },
+                           { 4, 4 }, { 4, 4 }, { 9, 9 }, { 9, 9 }, { 1, 1 }, { 1, 1 }, { 12, 12 } };
+        CHECK(lz::joinWhere(a, b, identity, identity, pair).toVector() == expected);
+    }
+
+    SECTION("Skewed sizes") {
+        std::vector<int> large;
+        for (int i = 0; i < 1000; ++i) {
+            large.push_back(i / 3);
+        }
+        std::vector<int> a{ 2, 2, 100, 101, 332, 400 };
+        Pairs expected = { { 2, 2 }, { 2, 2 }, { 2, 2 }, { 2, 2 }, { 2, 2 }, { 2, 2 }, { 100, 100 }, { 100, 100 }, { 100, 100 },
+                           { 101, 101 }, { 101, 101 }, { 101, 101 }, { 332, 332 }, { 332, 332 }, { 332, 332 } };
+        CHECK(lz::joinWhere(a, large, identity, identity, pair).toVector() == expected);
+    }
+
+    SECTION("Forward iterators") {
+        std::vector<int> a{ 1, 4, 4, 5, 15, 2 };
+        std::list<int> list(b.begin(), b.end());
+        Pairs expected = { { 1, 1 }, { 1, 1 }, { 4, 4 }, { 4, 4 }, { 4, 4 }, { 4, 4 }, { 4, 4 }, { 4, 4 }, { 15, 15 }, { 15, 15 },
+                           { 2, 2 } };
+        CHECK(lz::joinWhere(a, list, identity, identity, pair).toVector() == expected);
+    }
+}
@@ -3,6 +3,8 @@
 #include <algorithm>
 #include <catch2/catch.hpp>
 #include <cctype>
+#include <list>
+#include <numeric>
 
 template class lz::IterView<lz::internal::BasicIteratorView<std::vector<int>::iterator>::iterator>;
 
@@ -228,3 +230,127 @@ for (auto [chunk, expectedArr] : lz::zip(chunks, expected)) {
         CHECK(lz::toIter(arr).endsWith(std::array<int, 3>{13, 14, 15}));
     }
 }
+
+TEST_CASE("Push-based terminal operations") {
+    std::vector<int> vec = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+    std::vector<std::vector<int>> nested = { { 1, 2 }, {}, { 3 }, { 4, 5, 6 }, {} };
+
+    SECTION("Filter/map") {
+        auto chain = lz::toIter(vec).filter([](int i) { return i % 2 == 0; }).map([](int i) { return i * 10; });
+        CHECK(chain.sum() == 300);
+        CHECK(chain.count(40) == 1);
+        CHECK(chain.countIf([](int i) { return i > 50; }) == 3);
+        CHECK(chain.any([](int i) { return i == 100; }));
+        CHECK(chain.all([](int i) { return i % 20 == 0; }));
+        CHECK(chain.none([](int i) { return i == 10; }));
+        CHECK(chain.toVector() == std::vector<int>{ 20, 40, 60, 80, 100 });
+    }
+
+    SECTION("Flatten") {
+        auto chain = lz::toIter(lz::flatten(nested));
+        CHECK(chain.foldl(0, [](int acc, int i) { return acc * 10 + i; }) == 123456);
+        CHECK(chain.toVector() == std::vector<int>{ 1, 2, 3, 4, 5, 6 });
+        std::vector<int> taken;
+        lz::toIter(lz::take(chain, 4)).forEach([&taken](int i) { taken.push_back(i); });
+        CHECK(taken == std::vector<int>{ 1, 2, 3, 4 });
+    }
+
+    SECTION("Concatenate/zip") {
+        std::vector<int> other = { 11, 12 };
+        CHECK(lz::toIter(lz::concat(vec, other)).sum() == 78);
+        CHECK(lz::toIter(lz::take(lz::concat(vec, other), 7)).sum() == 28);
+        auto zipper = lz::toIter(lz::zip(vec, other)).map([](std::tuple<int&, int&> t) { return std::get<0>(t) * std::get<1>(t); });
+        CHECK(zipper.sum() == 35);
+    }
+
+    SECTION("Exclude/takeEvery/chunks") {
+        CHECK(lz::toIter(lz::exclude(vec, 2, 5)).toVector() == std::vector<int>{ 1, 2, 6, 7, 8, 9, 10 });
+        CHECK(lz::toIter(lz::take(lz::exclude(vec, 2, 5), 3)).sum() == 9);
+        CHECK(lz::toIter(lz::takeEvery(vec, 3)).toVector() == std::vector<int>{ 1, 4, 7, 10 });
+        CHECK(lz::toIter(lz::takeEvery(vec, 4, 1)).sum() == 2 + 6 + 10);
+        auto chunkSums = lz::toIter(lz::chunks(vec, 4)).map([](auto chunk) { return std::accumulate(chunk.begin(), chunk.end(), 0); });
+        CHECK(chunkSums.toVector() == std::vector<int>{ 10, 26, 19 });
+    }
+}
+
+TEST_CASE("Sized views") {
+    std::vector<int> vec = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+    std::list<int> list = { 1, 2, 3 };
+    int calls = 0;
+
+    auto excluded = lz::exclude(vec, 2, 5);
+    std::function<int(int)> timesTwo = [&calls](int i) {
+        ++calls;
+        return i * 2;
+    };
+    std::function<int(int)> identity = [](int i) {
+        return i;
+    };
+    auto map = lz::map(excluded, timesTwo);
+    auto listMap = lz::map(list, identity);
+    using MapIterator = decltype(map.begin());
+    static_assert(lz::internal::IsSized<MapIterator>::value, "map over a sized iterator should be sized");
+    static_assert(!lz::internal::IsRandomAccess<MapIterator>::value, "exclude is not random access");
+    static_assert(!lz::internal::IsSized<decltype(listMap.begin())>::value, "map over std::list should not be sized");
+
+    SECTION("Size is computed without evaluating") {
+        CHECK(map.size() == 7);
+        CHECK(lz::zip(map, vec).size() == 7);
+        CHECK(lz::concat(map, lz::map(excluded, identity)).size() == 14);
+        CHECK(lz::enumerate(excluded).size() == 7);
+        CHECK(calls == 0);
+    }
+
+    SECTION("Containers are only evaluated once") {
+        CHECK(map.toVector().size() == 7);
+        CHECK(calls == 7);
+        CHECK(lz::toIter(map).toUnorderedMap([](int i) { return i; }).size() == 7);
+        CHECK(calls == 14);
+    }
+
+    SECTION("Drop range") {
+        auto dropped = lz::dropRange(list.begin(), list.end(), 1);
+        CHECK(std::vector<int>(dropped.begin(), dropped.end()) == std::vector<int>{ 2, 3 });
+    }
+}
+
+TEST_CASE("Size hints") {
+    std::vector<int> vec = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+    std::list<int> list = { 1, 2, 3 };
+    std::function<bool(int)> isEven = [](int i) {
+        return i % 2 == 0;
+    };
+
+    SECTION("Sized views are exact") {
+        auto hint = lz::map(vec, std::function<int(int)>([](int i) { return i; })).sizeHint();
+        CHECK(hint.lower == 10);
+        CHECK(hint.upper == 10);
+        CHECK(hint.isExact());
+    }
+
+    SECTION("Unsized views are bounded by their underlying sequence") {
+        auto filtered = lz::filter(vec, isEven);
+        CHECK(filtered.sizeHint().lower == 1);
+        CHECK(filtered.sizeHint().upper == 9);
+        CHECK(lz::concat(filtered, vec).sizeHint().lower == 11);
+        CHECK(lz::concat(filtered, vec).sizeHint().upper == 19);
+        CHECK(lz::filter(list, isEven).sizeHint().upper == lz::internal::SizeHint::unbounded());
+        std::string sentence = "a b c";
+        CHECK(lz::split(sentence, ' ').sizeHint().upper == 5);
+        CHECK(lz::chunks(lz::filter(vec, isEven), 3).sizeHint().upper == 3);
+    }
+
+    SECTION("Unsized views are collected in one pass") {
+        std::vector<int> large = lz::range(1000).toVector();
+        int calls = 0;
+        std::function<bool(int)> counting = [&calls](int i) {
+            ++calls;
+            return i % 3 == 0;
+        };
+        auto result = lz::filter(large, counting).toVector();
+        CHECK(calls == 1000);
+        CHECK(result.size() == 334);
+        CHECK(result.back() == 999);
+        CHECK(lz::filter(list, isEven).to<std::vector<int>>() == std::vector<int>{ 2 });
+    }
+}
@@ -0,0 +1,87 @@
+#include <Lz/Lz.hpp>
+#include <Lz/MappedFile.hpp>
+#include <catch2/catch.hpp>
+#include <cstdio>
+#include <fstream>
+
+#ifdef LZ_HAS_MAPPED_FILE
+namespace {
+std::string writeFile(const std::string& contents) {
+    const std::string path = "lz-mapped-file-test.txt";
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file << contents;
+    return path;
+}
+} // namespace
+
+TEST_CASE("Mapped file changing and creating elements", "[Mapped file][Basic functionality]") {
+    const std::string path = writeFile("hello\nworld\n");
+    const lz::MappedFile file = lz::mmapFile(path);
+
+    SECTION("Should contain the bytes of the file") {
+        CHECK(file.size() == 12);
+        CHECK(std::string(file.begin(), file.end()) == "hello\nworld\n");
+    }
+
+    SECTION("Should be movable") {
+        lz::MappedFile other = lz::mmapFile(path);
+        const char* data = other.data();
+        lz::MappedFile moved(std::move(other));
+        CHECK(moved.data() == data);
+        CHECK(other.empty());
+    }
+
+    SECTION("Should throw if the file does not exist") {
+        CHECK_THROWS_AS(lz::mmapFile("lz-file-that-does-not-exist.txt"), std::system_error);
+    }
+    std::remove(path.c_str());
+}
+
+TEST_CASE("Mapped file lines", "[Mapped file][Lines]") {
+    SECTION("Line feeds") {
+        const std::string path = writeFile("hello\n\nworld\n");
+        const lz::MappedFile file = lz::mmapFile(path);
+        CHECK(lz::lines<std::string>(file).toVector() == std::vector<std::string>{ "hello", "", "world" });
+        std::remove(path.c_str());
+    }
+
+    SECTION("Carriage returns and no trailing line feed") {
+        const std::string path = writeFile("hello\r\nworld\r\n\r\nlast\r");
+        const lz::MappedFile file = lz::mmapFile(path);
+        CHECK(lz::lines<std::string>(file).toVector() == std::vector<std::string>{ "hello", "world", "", "last\r" });
+        std::remove(path.c_str());
+    }
+
+    SECTION("Empty file") {
+        const std::string path = writeFile("");
+        const lz::MappedFile file = lz::mmapFile(path);
+        CHECK(file.empty());
+        CHECK(lz::lines(file).toVector().empty());
+        std::remove(path.c_str());
+    }
+
+    SECTION("Over multiple blocks") {
+        std::string contents;
+        std::vector<std::string> expected;
+        for (int i = 0; i < 300; ++i) {
+            expected.push_back(std::string(static_cast<std::size_t>(i % 90), 'x') + std::to_string(i));
+            contents += expected.back() + (i % 2 == 0 ? "\n" : "\r\n");
+        }
+        const std::string path = writeFile(contents);
+        const lz::MappedFile file = lz::mmapFile(path);
+        CHECK(lz::lines<std::string>(file).toVector() == expected);
+        std::remove(path.c_str());
+    }
+
+    SECTION("Should compose with IterView") {
+        const std::string path = writeFile("1\n22\n333\n4444");
+        const lz::MappedFile file = lz::mmapFile(path);
+        const auto lengths = lz::toIter(lz::lines<std::string>(file))
+                                 .filter([](const std::string& line) { return line.size() % 2 == 0; })
+                                 .map([](const std::string& line) { return line.size(); })
+                                 .toVector();
+        CHECK(lengths == std::vector<std::size_t>{ 2, 4 });
+        std::remove(path.c_str());
+    }
+}
+#endif // LZ_HAS_MAPPED_FILE
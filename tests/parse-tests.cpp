@@ -0,0 +1,74 @@
+#include <Lz/Lz.hpp>
+#include <catch2/catch.hpp>
+#include <limits>
+#include <list>
+
+TEST_CASE("Parse changing and creating elements", "[Parse][Basic functionality]") {
+    const std::string line = "1,-20,300,abc,,4x,99999999999";
+    const auto parsed = lz::parse<int>(lz::split(line, ',')).toVector();
+
+    SECTION("Should parse valid numbers") {
+        REQUIRE(parsed.size() == 7);
+        CHECK(parsed[0]);
+        CHECK(parsed[0].value == 1);
+        CHECK(parsed[1].value == -20);
+        CHECK(parsed[2].value == 300);
+    }
+
+    SECTION("Should report errors") {
+        CHECK(parsed[3].error == std::errc::invalid_argument);
+        CHECK(parsed[4].error == std::errc::invalid_argument);
+        CHECK(parsed[5].error == std::errc::invalid_argument);
+        CHECK(parsed[6].error == std::errc::result_out_of_range);
+        CHECK_FALSE(parsed[6]);
+        CHECK(parsed[6].valueOr(-1) == -1);
+    }
+}
+
+TEST_CASE("Parse integer limits", "[Parse][Limits]") {
+    const std::vector<std::string> strings = { "-128", "127", "-129", "128", "+1", " 1", "-" };
+    const auto parsed = lz::parse<signed char>(strings).toVector();
+    CHECK(parsed[0].value == -128);
+    CHECK(parsed[1].value == 127);
+    CHECK(parsed[2].error == std::errc::result_out_of_range);
+    CHECK(parsed[3].error == std::errc::result_out_of_range);
+    CHECK(parsed[4].error == std::errc::invalid_argument);
+    CHECK(parsed[5].error == std::errc::invalid_argument);
+    CHECK(parsed[6].error == std::errc::invalid_argument);
+
+    const std::vector<std::string> unsignedStrings = { "18446744073709551615", "18446744073709551616", "-1" };
+    const auto parsedUnsigned = lz::parse<std::uint64_t>(unsignedStrings).toVector();
+    CHECK(parsedUnsigned[0].value == (std::numeric_limits<std::uint64_t>::max)());
+    CHECK(parsedUnsigned[1].error == std::errc::result_out_of_range);
+    CHECK(parsedUnsigned[2].error == std::errc::invalid_argument);
+}
+
+TEST_CASE("Parse floating points", "[Parse][Floating point]") {
+    const std::string line = "1.5;-2e3;.25;x;1e999;3.0f";
+    const auto parsed = lz::parse<double>(lz::split(line, ';')).toVector();
+    REQUIRE(parsed.size() == 6);
+    CHECK(parsed[0].value == 1.5);
+    CHECK(parsed[1].value == -2000.0);
+    CHECK(parsed[2].value == 0.25);
+    CHECK(parsed[3].error == std::errc::invalid_argument);
+    CHECK(parsed[4].error == std::errc::result_out_of_range);
+    CHECK(parsed[5].error == std::errc::invalid_argument);
+}
+
+TEST_CASE("Parse valid", "[Parse][Skip errors]") {
+    const std::string line = "1,x,2,,3,4.5";
+
+    SECTION("Should skip strings that cannot be parsed") {
+        CHECK(lz::parseValid<int>(lz::split(line, ',')).toVector() == std::vector<int>{ 1, 2, 3 });
+    }
+
+    SECTION("Should be usable from IterView") {
+        CHECK(lz::toIter(lz::split(line, ',')).parseValidAs<int>().sum() == 6);
+        CHECK(lz::toIter(lz::split(line, ',')).parseAs<double>().countIf([](lz::ParseResult<double> r) { return !r; }) == 2);
+    }
+
+    SECTION("Empty") {
+        const std::list<std::string> empty;
+        CHECK(lz::parseValid<int>(empty).toVector().empty());
+    }
+}
@@ -1,3 +1,4 @@
+#include <Lz/Generate.hpp>
 #include <Lz/Random.hpp>
 #include <catch2/catch.hpp>
 #include <list>
@@ -119,3 +120,62 @@ TEST_CASE("Random to containers", "[Random][To container]") {
         CHECK(actual.size() == size);
     }
 }
+
+TEST_CASE("Random engines", "[Random][Engines]") {
+    SECTION("SplitMix64 reference output") {
+        lz::SplitMix64 engine(1234567);
+        const std::array<std::uint64_t, 3> expected = { 6457827717110365317u, 3203168211198807973u, 9817491932198370423u };
+        CHECK(lz::generate(std::ref(engine), 3).toArray<3>() == expected);
+    }
+
+    SECTION("Xoshiro256** reference output") {
+        lz::Xoshiro256StarStar engine(std::array<std::uint64_t, 4>{ 1, 2, 3, 4 });
+        const std::array<std::uint64_t, 4> expected = { 11520u, 0u, 1509978240u, 1215971899390074240u };
+        CHECK(lz::generate(std::ref(engine), 4).toArray<4>() == expected);
+    }
+
+    SECTION("PCG64 reference output") {
+        lz::Pcg64 engine(42, 54);
+        const std::array<std::uint64_t, 3> expected = { 0x86b1da1d72062b68u, 0x1304aa46c9853d39u, 0xa3670e9e0dd50358u };
+        CHECK(lz::generate(std::ref(engine), 3).toArray<3>() == expected);
+    }
+
+    SECTION("Usable with the standard distributions") {
+        lz::Pcg64 engine;
+        std::uniform_int_distribution<int> distribution(-3, 3);
+        auto numbers = lz::random(distribution, engine, 1000);
+        CHECK(std::all_of(numbers.begin(), numbers.end(), [](int i) { return i >= -3 && i <= 3; }));
+        CHECK(lz::Xoshiro256StarStar(7) == lz::Xoshiro256StarStar(7));
+        CHECK(lz::Xoshiro256StarStar(7) != lz::Xoshiro256StarStar(8));
+    }
+}
+
+TEST_CASE("Random with inline engines", "[Random][Engines]") {
+    SECTION("Should stay between min and max") {
+        auto doubles = lz::random<double, lz::Xoshiro256StarStar>(-1., 1., 1000);
+        CHECK(std::all_of(doubles.begin(), doubles.end(), [](double d) { return d >= -1. && d <= 1.; }));
+        auto ints = lz::random<int, lz::Pcg64>(1, 6, 1000);
+        CHECK(std::all_of(ints.begin(), ints.end(), [](int i) { return i >= 1 && i <= 6; }));
+        CHECK(std::distance(ints.begin(), ints.end()) == 1000);
+    }
+
+    SECTION("Should seed every view differently") {
+        const auto first = lz::random<std::uint64_t, lz::SplitMix64>(0u, UINT64_MAX, 4).toArray<4>();
+        const auto second = lz::random<std::uint64_t, lz::SplitMix64>(0u, UINT64_MAX, 4).toArray<4>();
+        CHECK(first != second);
+    }
+
+    SECTION("Copies of an iterator should generate the same numbers") {
+        auto random = lz::random<std::uint64_t, lz::Xoshiro256StarStar>(0u, UINT64_MAX);
+        auto it = random.begin();
+        auto copy = it;
+        CHECK(*it == *copy);
+        const auto next = random.nextRandom();
+        CHECK(next != random.nextRandom());
+    }
+
+    SECTION("Should share large engines") {
+        auto random = lz::random<int, std::mt19937>(0, 10, 5);
+        CHECK(std::all_of(random.begin(), random.end(), [](int i) { return i >= 0 && i <= 10; }));
+    }
+}
@@ -5,6 +5,7 @@
 #include <Lz/StringSplitter.hpp>
 
 #include <catch2/catch.hpp>
+#include <sstream>
 
 
 TEST_CASE("Overall tests with LZ_STANDALONE defined") {
@@ -32,4 +33,32 @@ TEST_CASE("Overall tests with LZ_STANDALONE defined") {
     std::array<double, 4> vec = { 1.1, 2.2, 3.3, 4.4 };
     auto doubles = lz::strJoin(vec, ", ");
     CHECK(doubles == "1.1, 2.2, 3.3, 4.4");
+
+    SECTION("Arithmetic values are written in their shortest form") {
+        std::array<double, 3> fractions = { 0.1 + 0.2, 1.0, -2.5e-300 };
+        CHECK(lz::strJoin(fractions, " ") == "0.30000000000000004 1 -2.5e-300");
+
+        std::array<long long, 2> limits = { (std::numeric_limits<long long>::min)(), (std::numeric_limits<long long>::max)() };
+        CHECK(lz::join(limits, ",").toString() == "-9223372036854775808,9223372036854775807");
+
+        std::array<char, 2> chars = { 'a', 'b' };
+        CHECK(lz::strJoin(chars, ",") == "a,b");
+        CHECK(lz::map(chars, [](char c) { return c; }).toString(",") == "a,b");
+
+        std::array<bool, 2> flags = { true, false };
+        CHECK(lz::strJoin(flags, ",") == "true,false");
+        CHECK(lz::map(flags, [](bool b) { return b; }).toString(",") == "true,false");
+    }
+
+    SECTION("Formatting to outputs without a string of the whole view") {
+        std::array<int, 3> values = { 1, 2, 3 };
+        std::string result;
+        lz::map(values, [](int i) { return i * 2; }).formatTo(std::back_inserter(result), ", ");
+        CHECK(result == "2, 4, 6");
+
+        std::ostringstream stream;
+        lz::join(values, "+").writeTo(stream, "", 2);
+        stream << ' ' << lz::map(values, [](int i) { return i; });
+        CHECK(stream.str() == "1+2+3 1 2 3");
+    }
 }
\ No newline at end of file
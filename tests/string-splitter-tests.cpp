@@ -1,4 +1,5 @@
 #include <Lz/StringSplitter.hpp>
+#include <Lz/ThreadPool.hpp>
 #include <catch2/catch.hpp>
 #include <fmt/format.h>
 #include <list>
@@ -116,3 +117,149 @@ TEST_CASE("String splitter to containers", "[String splitter][To container]") {
         CHECK(actual == expected);
     }
 }
+
+TEST_CASE("String splitter with short delimiters over multiple blocks", "[String splitter][Block scan]") {
+    // Builds a string of 500 tokens that span multiple blocks, of which every eleventh is empty, together with its tokens
+    std::vector<std::string> expected;
+    const auto join = [&expected](const std::string& delimiter) {
+        std::string toSplit;
+        expected.clear();
+        for (int i = 0; i < 500; ++i) {
+            expected.push_back(i % 11 == 0 ? "" : std::to_string(i * 7) + (i % 3 == 0 ? " \r" : ""));
+            toSplit += expected.back() + delimiter;
+        }
+        return toSplit;
+    };
+
+    SECTION("Single character") {
+        const std::string toSplit = join(",");
+        CHECK(lz::split<std::string>(toSplit, ',').toVector() == expected);
+    }
+
+    SECTION("Two up to four characters") {
+        for (const std::string delimiter : { ", ", "\r\n", ",,", ";,\r\n" }) {
+            const std::string toSplit = join(delimiter);
+            CHECK(lz::split<std::string>(toSplit, delimiter).toVector() == expected);
+        }
+    }
+
+    SECTION("Overlapping delimiters") {
+        const std::string repeated(130, 'a');
+        std::vector<std::string> thirds(43);
+        thirds.emplace_back("a");
+        CHECK(lz::split<std::string>(repeated, "aa").toVector() == std::vector<std::string>(65));
+        CHECK(lz::split<std::string>(repeated, "aaa").toVector() == thirds);
+    }
+}
+
+TEST_CASE("String splitter with long delimiters", "[String splitter][Long delimiter]") {
+    const std::string boundary = "--boundary42\r\n";
+    std::string toSplit = "first part" + boundary + "second--boundary4 part" + boundary + boundary + "third part" + boundary;
+    auto splitter = lz::split<std::string>(toSplit, boundary);
+    auto copy = splitter.begin();
+
+    CHECK(splitter.toVector() == std::vector<std::string>{ "first part", "second--boundary4 part", "", "third part" });
+    CHECK(*copy == "first part");
+    ++copy;
+    CHECK(*copy == "second--boundary4 part");
+
+    const std::string repeated(100, 'a');
+    CHECK(lz::split<std::string>(repeated, std::string(30, 'a')).toVector() ==
+          std::vector<std::string>{ "", "", "", "aaaaaaaaaa" });
+}
+
+TEST_CASE("Split any and split whitespace", "[String splitter][Split any]") {
+    SECTION("Basic") {
+        const std::string toSplit = "a,b;c|d";
+        const std::string consecutive = "a,;b,";
+        const std::string leading = ",a";
+        const std::string empty;
+        CHECK(lz::splitAny<std::string>(toSplit, ",;|").toVector() == std::vector<std::string>{ "a", "b", "c", "d" });
+        CHECK(lz::splitAny<std::string>(consecutive, ",;").toVector() == std::vector<std::string>{ "a", "", "b" });
+        CHECK(lz::splitAny<std::string>(leading, ",").toVector() == std::vector<std::string>{ "", "a" });
+        CHECK(lz::splitAny(empty, ",").toVector().empty());
+    }
+
+    SECTION("Collapse") {
+        const std::string toSplit = ",,a,;b,,";
+        CHECK(lz::splitAny<std::string>(toSplit, ",;", true).toVector() == std::vector<std::string>{ "a", "b" });
+        const std::string onlyDelimiters = ",;,";
+        CHECK(lz::splitAny(onlyDelimiters, ",;", true).toVector().empty());
+    }
+
+    SECTION("Whitespace") {
+        const std::string toSplit = "  hello\tworld \r\n  foo\v\fbar ";
+        CHECK(lz::splitWhitespace<std::string>(toSplit).toVector() == std::vector<std::string>{ "hello", "world", "foo", "bar" });
+        CHECK(lz::splitWhitespace<std::string>(toSplit, false).toVector() ==
+              std::vector<std::string>{ "", "", "hello", "world", "", "", "", "", "foo", "", "bar" });
+    }
+
+    SECTION("Over multiple blocks") {
+        // 400 tokens that span multiple blocks, of which every seventh is followed by a second delimiter and thus an empty token
+        for (const std::string delimiters : { " ,\t", " ,;\t|-#@!" }) {
+            std::string toSplit;
+            std::vector<std::string> tokens;
+            std::vector<std::string> withEmpty;
+            for (std::size_t i = 0; i < 400; ++i) {
+                tokens.push_back(std::to_string(i * 13) + "x");
+                withEmpty.push_back(tokens.back());
+                toSplit += tokens.back() + delimiters[i % delimiters.size()];
+                if (i % 7 == 0) {
+                    withEmpty.emplace_back();
+                    toSplit += delimiters[(i + 1) % delimiters.size()];
+                }
+            }
+            CHECK(lz::splitAny<std::string>(toSplit, delimiters).toVector() == withEmpty);
+            CHECK(lz::splitAny<std::string>(toSplit, delimiters, true).toVector() == tokens);
+        }
+    }
+}
+
+TEST_CASE("Indexed string splitter", "[String splitter][Indexed]") {
+    std::string toSplit;
+    for (int i = 0; i < 30000; ++i) {
+        toSplit += std::to_string(i);
+        toSplit += i % 5 == 0 ? "aaa" : i % 3 == 0 ? "--boundary--" : ",";
+    }
+
+    SECTION("Should return the same tokens as the splitter") {
+        for (const std::string delimiter : { ",", "aa", "aaa", "--boundary--", "a", "not found" }) {
+            auto splitter = lz::split<std::string>(toSplit, delimiter);
+            CHECK(splitter.indexed().toVector() == splitter.toVector());
+        }
+        auto charSplitter = lz::split<std::string>(toSplit, ',');
+        CHECK(charSplitter.indexed().toVector() == charSplitter.toVector());
+    }
+
+    SECTION("Should be random access") {
+        const std::string small = "a,bc,,d,";
+        const auto indexed = lz::split<std::string>(small, ',').indexed();
+        CHECK(indexed.size() == 4);
+        CHECK(indexed[1] == "bc");
+        CHECK(indexed[2].empty());
+        CHECK(*(indexed.end() - 1) == "d");
+        CHECK(indexed.end() - indexed.begin() == 4);
+
+        const std::string empty;
+        CHECK(lz::split<std::string>(empty, ',').indexed().size() == 0);
+    }
+
+    SECTION("Should reject an empty delimiter") {
+        CHECK_THROWS_AS(lz::split<std::string>(toSplit, "").indexed(), std::invalid_argument);
+#ifdef LZ_HAS_EXECUTION
+        CHECK_THROWS_AS(lz::split<std::string>(toSplit, "").indexed(std::execution::par), std::invalid_argument);
+#endif // LZ_HAS_EXECUTION
+    }
+
+#ifdef LZ_HAS_EXECUTION
+    SECTION("Should scan in parallel") {
+        lz::ThreadPool pool(4);
+        for (const std::string delimiter : { ",", "aa", "--boundary--" }) {
+            auto splitter = lz::split<std::string>(toSplit, delimiter);
+            const auto expected = splitter.toVector();
+            CHECK(splitter.indexed(std::execution::par).toVector() == expected);
+            CHECK(splitter.indexed(pool.executor()).toVector() == expected);
+        }
+    }
+#endif // LZ_HAS_EXECUTION
+}
@@ -0,0 +1,192 @@
+#include <Lz/Lz.hpp>
+#include <catch2/catch.hpp>
+#include <atomic>
+#include <functional>
+#include <list>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+TEST_CASE("Thread pool basic functionality", "[ThreadPool][Basic functionality]") {
+    lz::ThreadPool pool(4);
+    CHECK(pool.size() == 4);
+
+    SECTION("Parallel for visits every index once") {
+        std::vector<int> visited(1000);
+        pool.parallelFor(visited.size(), [&visited](const std::size_t i) { ++visited[i]; });
+        CHECK(std::all_of(visited.begin(), visited.end(), [](int i) { return i == 1; }));
+    }
+
+    SECTION("Nested parallel for") {
+        std::atomic<int> counter{ 0 };
+        pool.parallelFor(8, [&pool, &counter](std::size_t) {
+            pool.parallelFor(8, [&counter](std::size_t) { ++counter; });
+        });
+        CHECK(counter == 64);
+    }
+
+    SECTION("Exceptions are rethrown") {
+        std::atomic<int> counter{ 0 };
+        CHECK_THROWS_AS(pool.parallelFor(100,
+                                         [&counter](const std::size_t i) {
+                                             ++counter;
+                                             if (i == 50) {
+                                                 throw std::runtime_error("error");
+                                             }
+                                         }),
+                        std::runtime_error);
+        CHECK(counter == 100);
+    }
+
+    SECTION("Submit") {
+        std::atomic<int> counter{ 0 };
+        {
+            lz::ThreadPool other(2);
+            for (int i = 0; i < 100; ++i) {
+                other.submit([&counter] { ++counter; });
+            }
+        }
+        CHECK(counter == 100);
+    }
+}
+
+#ifdef LZ_HAS_EXECUTION
+TEST_CASE("Thread pool as execution policy", "[ThreadPool][Execution]") {
+    lz::ThreadPool pool(4);
+    const auto executor = pool.executor();
+    std::vector<int> vec(10000);
+    std::iota(vec.begin(), vec.end(), 0);
+
+    SECTION("Terminal operations") {
+        auto view = lz::toIter(vec);
+        CHECK(view.sum(executor) == std::accumulate(vec.begin(), vec.end(), 0));
+        CHECK(view.count(10, executor) == 1);
+        CHECK(view.countIf([](int i) { return i % 2 == 0; }, executor) == 5000);
+        CHECK(view.max(std::less<int>(), executor) == 9999);
+        CHECK(view.min(std::less<int>(), executor) == 0);
+        CHECK(view.all([](int i) { return i >= 0; }, executor));
+        CHECK(view.isSorted(std::less<int>(), executor));
+    }
+
+    SECTION("Sort") {
+        std::vector<int> reversed(vec.rbegin(), vec.rend());
+        lz::toIter(reversed).sort(std::less<int>(), executor);
+        CHECK(reversed == vec);
+    }
+
+    SECTION("Filter") {
+        auto filtered = lz::filter(vec, [](int i) { return i % 3 == 0; }, executor).toVector(executor);
+        CHECK(filtered.size() == 3334);
+        CHECK(filtered.back() == 9999);
+
+        std::vector<int> output(2000);
+        lz::filter(vec, [](int i) { return i % 5 == 0; }, executor).copyTo(output.begin());
+        CHECK(output[1] == 5);
+        CHECK(output.back() == 9995);
+
+        std::function<bool(int)> isOdd = [](int i) { return i % 2 != 0; };
+        auto chained = lz::toIter(vec).filter(isOdd, executor).toVector();
+        CHECK(chained.size() == 5000);
+        CHECK(std::all_of(chained.begin(), chained.end(), isOdd));
+
+        std::atomic<int> calls{ 0 };
+        std::function<int(int)> counted = [&calls](int i) {
+            ++calls;
+            return i * 2;
+        };
+        // Every element is mapped once while collecting, the view itself maps the first element to find its begin
+        auto multiplesOfFour = lz::filter(lz::map(vec, counted), [](int i) { return i % 4 == 0; }, executor);
+        calls = 0;
+        auto doubled = multiplesOfFour.toVector(executor);
+        CHECK(doubled.size() == 5000);
+        CHECK(doubled[1] == 4);
+        CHECK(calls == 10000);
+
+        auto multiplesOfTen = lz::filter(lz::map(vec, counted), [](int i) { return i % 10 == 0; }, executor);
+        calls = 0;
+        multiplesOfTen.copyTo(output.begin(), executor);
+        CHECK(output[1] == 10);
+        CHECK(calls == 10000);
+    }
+
+    SECTION("Materialize random access chain") {
+        std::vector<int> expected(vec.size());
+        std::transform(vec.begin(), vec.end(), expected.begin(), [](int i) { return i * 2; });
+        std::function<int(int)> twice = [](int i) { return i * 2; };
+        CHECK(lz::map(vec, twice).toVector(executor) == expected);
+
+        std::function<std::string(int)> toString = [](int i) { return std::to_string(i); };
+        auto strings = lz::map(vec, toString).toVector(executor);
+        REQUIRE(strings.size() == vec.size());
+        CHECK(strings[1234] == "1234");
+
+        auto zipped = lz::zip(vec, expected).toVector(executor);
+        REQUIRE(zipped.size() == vec.size());
+        CHECK(zipped[42] == std::make_tuple(42, 84));
+
+        std::vector<int> output(vec.size());
+        lz::map(vec, twice).copyTo(output.begin(), executor);
+        CHECK(output == expected);
+
+        struct NoDefault {
+            explicit NoDefault(int i) : value(i) {
+            }
+
+            int value;
+        };
+        std::function<NoDefault(int)> wrap = [](int i) { return NoDefault(i); };
+        auto wrapped = lz::map(vec, wrap).toVector(executor);
+        REQUIRE(wrapped.size() == vec.size());
+        CHECK(wrapped[1234].value == 1234);
+        CHECK(wrapped.back().value == 9999);
+    }
+
+    SECTION("Collect chains that are not random access once") {
+        std::list<int> list(vec.begin(), vec.end());
+        std::atomic<int> calls{ 0 };
+        std::function<bool(int)> isEven = [&calls](int i) {
+            ++calls;
+            return i % 2 == 0;
+        };
+        // The view itself tests the first element to find its begin
+        auto evens = lz::filter(list, isEven);
+        calls = 0;
+        CHECK(evens.toVector(executor).size() == 5000);
+        CHECK(calls == 9999);
+    }
+
+    SECTION("Join where") {
+        std::vector<int> keys{ 7, 3, 3, 9, 1, 4 };
+        std::vector<std::pair<int, int>> sortedValues{ { 1, 10 }, { 3, 30 }, { 3, 31 }, { 4, 40 }, { 8, 80 } };
+        std::function<int(int)> selectA = [](int i) { return i; };
+        std::function<int(const std::pair<int, int>&)> selectB = [](const std::pair<int, int>& p) { return p.first; };
+        std::function<int(int, const std::pair<int, int>&)> result = [](int, const std::pair<int, int>& p) { return p.second; };
+
+        const std::vector<int> expected{ 30, 31, 30, 31, 10, 40 };
+        CHECK(lz::joinWhere(keys, sortedValues, selectA, selectB, result, executor).toVector() == expected);
+        auto joined = lz::joinWhere(keys, sortedValues, selectA, selectB, result, executor);
+        CHECK(std::vector<int>(joined.begin(), joined.end()) == expected);
+    }
+
+    SECTION("To string") {
+        auto view = lz::toIter(vec);
+        CHECK(view.toString(", ", "{}", executor) == view.toString(", "));
+        CHECK(view.toString("", "{:x}", executor) == view.toString("", "{:x}"));
+        CHECK(view.toString(",", "{}", std::execution::par) == view.toString(","));
+        CHECK(view.toString(" ", "{}", lz::ThreadPoolExecutor()) == view.toString(" "));
+        CHECK(lz::range(0).toString(", ", "{}", executor).empty());
+        CHECK(lz::range(1).toString(", ", "{}", executor) == "0");
+
+        std::vector<std::string> strings{ "a", "bc", "", "def" };
+        CHECK(lz::toIter(strings).toString("--", "{}", executor) == "a--bc----def");
+        CHECK(lz::filter(vec, [](int i) { return i < 3; }).toString(" ", "{}", executor) == "0 1 2");
+    }
+
+    SECTION("Function tools") {
+        CHECK(lz::contains(vec, 9999, executor));
+        CHECK(lz::indexOf(vec, 777, executor) == 777);
+        CHECK(lz::equal(vec, vec, std::equal_to<int>(), executor));
+    }
+}
+#endif // LZ_HAS_EXECUTION